@@ -20,11 +20,20 @@
 #define _IS_CORE_INTERNAL_CONFIG_HPP_
 
 #include <is/systemhandle/RegisterSystem.hpp>
+#include <is/core/Introspection.hpp>
+#include <is/core/RuntimeContext.hpp>
 #include <is/core/runtime/Search.hpp>
 #include <is/core/runtime/MiddlewareInterfaceExtension.hpp>
+#include <is/core/runtime/Realtime.hpp>
+#include <is/core/runtime/ServiceBatcher.hpp>
+#include <is/core/runtime/ServiceHedging.hpp>
+#include <is/core/runtime/SpinPolicy.hpp>
+#include <is/core/runtime/ThreadSettings.hpp>
 
 #include <yaml-cpp/yaml.h>
 
+#include <chrono>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -51,6 +60,9 @@ namespace internal {
  *
  * @var MiddlewareConfig::config_node
  *      @brief YAML configuration associated with the specific middleware.
+ *
+ * @var MiddlewareConfig::spin
+ *      @brief What the thread spinning this middleware does while it is idle.
  */
 struct MiddlewareConfig
 {
@@ -58,6 +70,7 @@ struct MiddlewareConfig
     std::vector<std::string> types_from;
     YAML::Node config_node;
     YAML::Node types_node;
+    SpinPolicy spin;
 };
 
 /**
@@ -178,6 +191,9 @@ using ServiceInfo = TopicInfo;
  *
  * @var TopicConfig::middleware_configs
  *      @brief A map with the YAML configuration for the specific topic.
+ *
+ * @var TopicConfig::on_demand
+ *      @brief Whether the sources are only subscribed while some destination has subscribers.
  */
 struct TopicConfig
 {
@@ -187,6 +203,8 @@ struct TopicConfig
     std::map<std::string, TopicInfo> remap; //  The "key" is the middleware alias.
 
     std::map<std::string, YAML::Node> middleware_configs;
+
+    bool on_demand = false; //  Optional
 };
 
 /**
@@ -207,6 +225,12 @@ struct TopicConfig
  *
  * @var ServiceConfig::middleware_configs
  *      @brief A map with the YAML configuration for the specific service.
+ *
+ * @var ServiceConfig::hedging
+ *      @brief Hedging policy for the requests of this service, if enabled.
+ *
+ * @var ServiceConfig::batching
+ *      @brief Batching policy for the requests of this service, if enabled.
  */
 struct ServiceConfig
 {
@@ -217,6 +241,188 @@ struct ServiceConfig
     std::map<std::string, ServiceInfo> remap; //  The "key" is the middleware alias.
 
     std::map<std::string, YAML::Node> middleware_configs;
+
+    std::optional<ServiceHedging::Policy> hedging; //  Optional
+
+    std::optional<ServiceBatcher::Policy> batching; //  Optional
+};
+
+/**
+ * @struct ExecutorThreadConfig
+ * @brief Describes a thread of the executor, and the systems that it spins.
+ *
+ * @var ExecutorThreadConfig::settings
+ *      @brief Name and CPU affinity of the thread.
+ *
+ * @var ExecutorThreadConfig::systems
+ *      @brief Aliases of the systems spun by this thread, in turns.
+ *
+ * @var ExecutorThreadConfig::spin
+ *      @brief What the thread does when none of its systems had anything to do.
+ */
+struct ExecutorThreadConfig
+{
+    ThreadSettings settings;
+    std::vector<std::string> systems;
+    SpinPolicy spin;
+};
+
+/**
+ * @struct ShardsConfig
+ * @brief Describes the shards that forward the topics, when the sharded mode is enabled.
+ *
+ * @var ShardsConfig::count
+ *      @brief Number of shards. The sharded mode is disabled if it is zero.
+ *
+ * @var ShardsConfig::queue_size
+ *      @brief Capacity of each queue between a middleware thread and a shard.
+ *
+ * @var ShardsConfig::cpus
+ *      @brief CPU where each shard is pinned, by index. Shards beyond its size are not pinned.
+ */
+struct ShardsConfig
+{
+    std::size_t count = 0;
+    std::size_t queue_size = 1024;
+    std::vector<int> cpus;
+};
+
+/**
+ * @struct ExecutorConfig
+ * @brief Stores the `executor` section of the configuration, which describes
+ *        the threads that run the SystemHandles.
+ *
+ * @var ExecutorConfig::threads
+ *      @brief Threads explicitly configured. Every system can be assigned to one of them at most.
+ *
+ * @var ExecutorConfig::reactor
+ *      @brief Settings for the thread that runs the event driven systems.
+ *
+ * @var ExecutorConfig::default_settings
+ *      @brief Settings for the dedicated threads of the systems not assigned to any thread.
+ *             Their name defaults to the system alias.
+ *
+ * @var ExecutorConfig::realtime
+ *      @brief Process wide settings of the real-time execution mode.
+ *
+ * @var ExecutorConfig::parallel_startup
+ *      @brief Loads and configures concurrently the systems that do not depend on each other.
+ *
+ * @var ExecutorConfig::shards
+ *      @brief Shards that forward the topics, instead of the middleware threads.
+ *
+ * @var ExecutorConfig::drain_timeout
+ *      @brief Maximum time that the instance waits for the work in flight when receiving `SIGTERM`.
+ *             If zero, `SIGTERM` keeps its default behaviour.
+ *
+ * @var ExecutorConfig::stall_threshold
+ *      @brief Time spent in a single spin after which a system is reported as stalled.
+ *             If zero, the stalls are not watched.
+ */
+struct ExecutorConfig
+{
+    std::vector<ExecutorThreadConfig> threads;
+    ThreadSettings reactor{"is-reactor", {}, 0, -1};
+    ThreadSettings default_settings;
+    RealtimeSettings realtime;
+    bool parallel_startup = false;
+    ShardsConfig shards;
+    std::chrono::milliseconds drain_timeout{0};
+    std::chrono::milliseconds stall_threshold{0};
+};
+
+/**
+ * @struct MetricsConfig
+ * @brief Stores the `metrics` section of the configuration, which enables the endpoint
+ *        serving the metrics of the instance to Prometheus scrapers.
+ *
+ * @var MetricsConfig::address
+ *      @brief IPv4 address where the endpoint listens. Only local scrapers are accepted by default.
+ *
+ * @var MetricsConfig::port
+ *      @brief TCP port where the endpoint listens. The endpoint is disabled if it is not set.
+ */
+struct MetricsConfig
+{
+    std::string address = "127.0.0.1";
+    std::optional<uint16_t> port;
+};
+
+/**
+ * @struct ProfilerConfig
+ * @brief Stores the `profiler` section of the configuration, which enables the utils::Profiler
+ *        to find out which conversions take the most time.
+ *
+ * @var ProfilerConfig::enabled
+ *      @brief Whether the conversions get profiled.
+ *
+ * @var ProfilerConfig::report_size
+ *      @brief Number of operations shown in the reports, zero meaning all of them.
+ */
+struct ProfilerConfig
+{
+    bool enabled = false;
+    std::size_t report_size = 20;
+};
+
+/**
+ * @struct ProbeConfig
+ * @brief Stores a latency probe of the `probes` section of the configuration.
+ *
+ * @var ProbeConfig::topic
+ *      @brief Topic where the probe messages are sent and received.
+ *
+ * @var ProbeConfig::from
+ *      @brief System where the probe messages are published. Empty if they are sent by another instance.
+ *             It must not be a source of the topic routing the probe messages in this instance.
+ *
+ * @var ProbeConfig::to
+ *      @brief System where the probe messages are received. Empty if they are measured by another instance.
+ *
+ * @var ProbeConfig::period
+ *      @brief Time between two probe messages.
+ */
+struct ProbeConfig
+{
+    std::string topic;
+    std::string from;
+    std::string to;
+    std::chrono::milliseconds period{1000};
+};
+
+/**
+ * @struct ConfigChanges
+ * @brief Topics and services that differ between two configurations, used to reload
+ *        a running instance. A modified item is listed both as removed and as added.
+ *
+ * @var ConfigChanges::topics_removed
+ *      @brief Topics of the running configuration that must be torn down.
+ *
+ * @var ConfigChanges::topics_added
+ *      @brief Topics of the new configuration that must be set up.
+ *
+ * @var ConfigChanges::services_removed
+ *      @brief Services of the running configuration that must be torn down.
+ *
+ * @var ConfigChanges::services_added
+ *      @brief Services of the new configuration that must be set up.
+ */
+struct ConfigChanges
+{
+    std::vector<std::string> topics_removed;
+    std::vector<std::string> topics_added;
+    std::vector<std::string> services_removed;
+    std::vector<std::string> services_added;
+
+    /**
+     * @brief Checks whether there is nothing to change.
+     */
+    bool empty() const
+    {
+        return topics_removed.empty() && topics_added.empty()
+               && services_removed.empty() && services_added.empty();
+    }
+
 };
 
 /**
@@ -291,7 +497,10 @@ public:
      *                  system to another. In this way, users do not have to redefine
      *                  types for each system.
      *
-     *             2.3. Custom configuration parameters, such as `domain_id` (for ROS 2).
+     *             2.3. `spin`: what the thread running the system does while it is idle:
+     *                  `busy_poll`, `yield`, `adaptive_backoff` or `blocking`.
+     *
+     *             2.4. Custom configuration parameters, such as `domain_id` (for ROS 2).
      *                  Each SystemHandle may define its own configuration fields,
      *                  please refer to their documentation for more details.
      *
@@ -324,6 +533,23 @@ public:
      *             4.4. Custom configuration parameters, which are specific for each middleware.
      *                  Please refer to the specific SystemHandle documentation.
      *
+     *          5. `executor`: Optional. Describes the threads that run the `systems`.
+     *
+     *             The following subsections are permitted:
+     *
+     *             5.1. `threads`: list of threads, each one with a `name`, a list of `cpus`
+     *                  to pin it to, a `numa_node` to bind it to, a real-time `priority`,
+     *                  the list of `systems` that it spins and its `spin` policy.
+     *
+     *             5.2. `reactor`: `name`, `cpus`, `numa_node` and `priority` of the thread that runs
+     *                  the event driven systems.
+     *
+     *             5.3. `default_cpus`, `default_numa_node`: CPUs and NUMA node for the threads
+     *                  of the systems not listed in `threads`.
+     *
+     *             5.4. `realtime`: enables the real-time mode: memory locking, pre-faulting and
+     *                  page fault monitoring. Priorities are set with `priority` in each thread.
+     *
      * @param[in] node The parsed YAML representation of the configuration file provided.
      *
      * @param[in] filename The path of the configuration file.
@@ -348,6 +574,98 @@ public:
      */
     operator bool() const;
 
+    /**
+     * @brief Gets the configuration of the threads that run the SystemHandles.
+     *
+     * @returns The parsed `executor` section, or its default values if it was not provided.
+     */
+    const ExecutorConfig& executor() const;
+
+    /**
+     * @brief Groups the middlewares in the order they are loaded in.
+     *
+     * @details Each level holds the middlewares that only take types, through `types-from`,
+     *          from those in the previous levels. The middlewares of a level are loaded
+     *          concurrently if `parallel_startup` is enabled in the `executor` section.
+     *
+     * @param[out] levels The names of the middlewares of each level.
+     *
+     * @returns `false` if the `types-from` references are circular, `true` otherwise.
+     */
+    bool startup_levels(
+            std::vector<std::vector<std::string> >& levels) const;
+
+    /**
+     * @brief Gets the configuration of the metrics endpoint.
+     *
+     * @returns The parsed `metrics` section, or its default values if it was not provided.
+     */
+    const MetricsConfig& metrics() const;
+
+    /**
+     * @brief Gets the configuration of the message tracing.
+     *
+     * @returns The parsed `tracing` section, or no value if tracing is disabled.
+     */
+    const std::optional<Tracer::Policy>& tracing() const;
+
+    /**
+     * @brief Gets the configuration of the conversion profiler.
+     *
+     * @returns The parsed `profiler` section, or its default values if it was not provided.
+     */
+    const ProfilerConfig& profiler() const;
+
+    /**
+     * @brief Sets up the latency probes of the `probes` section.
+     *
+     *        The sending side of each probe advertises its topic in the `from` system and starts
+     *        publishing the probe messages through the TimerQueue of the runtime. The receiving side
+     *        subscribes to it in the `to` system, measuring every probe message that arrives.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] subscription_callbacks Container where the new subscription callbacks get stored.
+     *
+     * @param[in] runtime The RuntimeContext of the instance, where the probes are kept.
+     *            It must outlive the subscription callbacks.
+     *
+     * @returns `true` if all the probes were successfully set up, `false` otherwise.
+     */
+    bool configure_probes(
+            const is::internal::SystemHandleInfoMap& info_map,
+            SubscriptionCallbacks& subscription_callbacks,
+            RuntimeContext& runtime) const;
+
+    /**
+     * @brief Gets the spin policy configured for a system.
+     *
+     * @param[in] middleware The alias of the system.
+     *
+     * @returns The SpinPolicy of the system, or the default one if it is unknown.
+     */
+    SpinPolicy spin_policy(
+            const std::string& middleware) const;
+
+    /**
+     * @brief Computes the topics and services to be torn down and set up in order to
+     *        go from a running configuration to this one.
+     *
+     *        Only the `routes`, `topics` and `services` sections can change while running.
+     *        Any difference in the `systems` or `types` sections makes the check fail, since
+     *        the SystemHandles would need to be loaded again. Changes in the `executor`
+     *        section are ignored, with a warning, until the instance gets restarted.
+     *
+     * @param[in] running The configuration the instance is currently running with.
+     *
+     * @param[out] changes The differences found, if the check succeeds.
+     *
+     * @returns `true` if the instance can be reloaded with this configuration, `false` otherwise.
+     */
+    bool changes_from(
+            const Config& running,
+            ConfigChanges& changes) const;
+
     /**
      * @brief Performs a search and loads the dynamic libraries required
      *        for each middleware, that is, the SystemHandle entities.
@@ -364,6 +682,10 @@ public:
      *          If one of the middlewares listed is not properly configured,
      *          the whole process fails.
      *
+     *          If `parallel_startup` is enabled in the `executor` section, the middlewares
+     *          that do not depend on each other through `types-from` are loaded and
+     *          configured concurrently.
+     *
      * @param[out] info_map Map between the middlewares and their SystemHandle
      *             instances information (handle pointer, topic publisher and subscriber
      *             and service client and provider systems, as well as its type registry).
@@ -408,11 +730,36 @@ public:
      * @param[in] subscription_callbacks Reference to the map used to store all of the active
      *            subscription callbacks for a certain SystemHandle instance.
      *
+     * @param[in] runtime The RuntimeContext of the instance, which holds the gates of
+     *            the topic routes. It must outlive the subscription callbacks.
+     *
      * @returns `true` if all the topics were successfully configured, `false` otherwise.
      */
     bool configure_topics(
             const is::internal::SystemHandleInfoMap& info_map,
-            SubscriptionCallbacks& subscription_callbacks) const;
+            SubscriptionCallbacks& subscription_callbacks,
+            RuntimeContext& runtime) const;
+
+    /**
+     * @brief Configures a single topic, as described in `configure_topics`.
+     *
+     *        Used as well to add topics to a running instance while reloading its configuration.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] topic_name The name of the topic to configure.
+     *
+     * @param[in] subscription_callbacks Container where the new subscription callbacks get stored.
+     *
+     * @param[in] runtime The RuntimeContext of the instance.
+     *
+     * @returns `true` if the topic was successfully configured, `false` otherwise.
+     */
+    bool configure_topic(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const std::string& topic_name,
+            SubscriptionCallbacks& subscription_callbacks,
+            RuntimeContext& runtime) const;
 
     /**
      * @brief Configures services, according to the specified route, type and remapping
@@ -438,6 +785,12 @@ public:
      *          to the client, if applicable (that is, if a `reply_type` has been defined
      *          in the *YAML* configuration.)
      *
+     *          If the service has a `hedging` policy, requests are forwarded through a
+     *          ServiceHedging instance, which may send a second request to the provider
+     *          when the first one takes too long.
+     *          Otherwise, if it has a `batching` policy, the requests received within
+     *          a short window are grouped and sent with `ServiceProvider::call_service_batch`.
+     *
      *          If any of the defined services cannot find server or client capabilities
      *          (i.e. invalid routes), the returned value will be false and the process will fail.
      *
@@ -448,11 +801,132 @@ public:
      * @param[in] request_callbacks Reference to the map used to store all of the active
      *            request callbacks for a certain SystemHandle instance.
      *
+     * @param[in] runtime The RuntimeContext of the instance, which provides the resources
+     *            needed by the request callbacks. It must outlive them.
+     *
      * @returns `true` if all the services were successfully configured, `false` otherwise.
      */
     bool configure_services(
             const is::internal::SystemHandleInfoMap& info_map,
-            RequestCallbacks& request_callbacks) const;
+            RequestCallbacks& request_callbacks,
+            RuntimeContext& runtime) const;
+
+    /**
+     * @brief Configures a single service, as described in `configure_services`.
+     *
+     *        Used as well to add services to a running instance while reloading its configuration.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] service_name The name of the service to configure.
+     *
+     * @param[in] request_callbacks Container where the new request callbacks get stored.
+     *
+     * @param[in] runtime The RuntimeContext of the instance.
+     *
+     * @returns `true` if the service was successfully configured, `false` otherwise.
+     */
+    bool configure_service(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const std::string& service_name,
+            RequestCallbacks& request_callbacks,
+            RuntimeContext& runtime) const;
+
+    /**
+     * @brief Describes the systems, topics and services of this configuration,
+     *        as they are set up in the loaded SystemHandles.
+     *
+     *        Only the static part of the description is filled: the live figures of the routes
+     *        are left for the caller.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[out] introspection The description to fill.
+     */
+    void describe(
+            const is::internal::SystemHandleInfoMap& info_map,
+            Introspection& introspection) const;
+
+    /**
+     * @brief Checks, before applying them, that the topics and services added by a reload
+     *        are compatible with the types of the running SystemHandles.
+     *
+     *        A topic that was configured before must ask its destination systems for the same
+     *        publishers as then, which get reused, since systems cannot remove their publishers.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] changes The changes computed by `changes_from`.
+     *
+     * @param[in] runtime The RuntimeContext of the instance, which keeps the publishers.
+     *
+     * @returns `true` if every added topic and service is compatible, `false` otherwise.
+     */
+    bool check_changes(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const ConfigChanges& changes,
+            const RuntimeContext& runtime) const;
+
+    /**
+     * @brief Checks, before applying them, that the topics and services removed by a reload
+     *        can be torn down by the running SystemHandles.
+     *
+     *        A modified topic needs all its source systems to support unsubscribing, so that
+     *        they do not keep a duplicate subscription. A removed or modified service needs all
+     *        its client systems to support removing their proxies, so that no client waits
+     *        forever for the reply to a request that nobody forwards.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] changes The changes computed by `changes_from`, against this configuration.
+     *
+     * @returns `true` if every removed topic and service can be torn down, `false` otherwise.
+     */
+    bool check_tear_down(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const ConfigChanges& changes) const;
+
+    /**
+     * @brief Disables a topic configured by `configure_topic`, and asks its source systems
+     *        to unsubscribe from it, if they support it.
+     *
+     *        The subscription callbacks are kept alive, since the SystemHandles may still be
+     *        using them, but no message gets forwarded anymore. The publishers are kept in the
+     *        RuntimeContext, to be reused if the topic gets configured again.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] topic_name The name of the topic to remove.
+     *
+     * @param[in] runtime The RuntimeContext where the topic was configured.
+     *
+     * @returns `true` if every source system unsubscribed, `false` if some of them
+     *          still deliver the messages of the topic, which get discarded.
+     */
+    bool tear_down_topic(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const std::string& topic_name,
+            RuntimeContext& runtime) const;
+
+    /**
+     * @brief Disables a service configured by `configure_service`, and asks its client systems
+     *        to remove their proxies.
+     *
+     *        The request callbacks and the provider are kept alive, so that the calls
+     *        in flight still get their replies.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] service_name The name of the service to remove.
+     *
+     * @param[in] runtime The RuntimeContext where the service was configured.
+     *
+     * @returns `true` if every client system removed its proxy, `false` otherwise.
+     */
+    bool tear_down_service(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const std::string& service_name,
+            RuntimeContext& runtime) const;
 
     /**
      * @brief Checks compatibility between the TopicInfo registered in the endpoints responsible
@@ -544,12 +1018,50 @@ public:
 
 private:
 
+    /**
+     * @brief Loads and configures the SystemHandle of a single middleware, as described
+     *        in `load_middlewares`.
+     *
+     * @param[in] mw_name The alias of the middleware.
+     *
+     * @param[in] info_map The middlewares already loaded, which must include those
+     *            listed in its `types-from`.
+     *
+     * @returns The information of the configured SystemHandle, which evaluates to `false`
+     *          if it could not be loaded.
+     */
+    is::internal::SystemHandleInfo load_middleware(
+            const std::string& mw_name,
+            const is::internal::SystemHandleInfoMap& info_map) const;
+
+    /**
+     * @brief Describes the publisher that a destination system of a topic gets asked for,
+     *        without asking for it.
+     *
+     * @param[in] info_map Information of the loaded SystemHandles.
+     *
+     * @param[in] topic_name The name of the topic.
+     *
+     * @param[in] config The configuration of the topic.
+     *
+     * @param[in] to The destination system, which must be loaded.
+     *
+     * @returns The Advertisement, without a publisher.
+     */
+    Advertisement advertisement(
+            const is::internal::SystemHandleInfoMap& info_map,
+            const std::string& topic_name,
+            const TopicConfig& config,
+            const std::string& to) const;
+
     /**
      * Class members.
      */
 
     bool _okay;
 
+    YAML::Node _m_node;
+
     std::map<std::string, MiddlewareConfig> _m_middlewares;
 
     std::map<std::string, TopicRoute> _m_topic_routes;
@@ -564,6 +1076,16 @@ private:
 
     std::map<std::string, eprosima::xtypes::DynamicType::Ptr> _m_types;
 
+    ExecutorConfig _m_executor;
+
+    MetricsConfig _m_metrics;
+
+    std::optional<Tracer::Policy> _m_tracing;
+
+    ProfilerConfig _m_profiler;
+
+    std::map<std::string, ProbeConfig> _m_probes;
+
 };
 
 } //  namespace internal
@@ -24,13 +24,18 @@
 #include <is/core/export.hpp>
 
 #include <is/core/Config.hpp>
+#include <is/core/Introspection.hpp>
 #include <is/core/runtime/Search.hpp>
+#include <is/core/runtime/LatencyProbe.hpp>
 #include <is/core/runtime/MiddlewareInterfaceExtension.hpp>
+#include <is/core/runtime/RouteMetrics.hpp>
 #include <is/systemhandle/SystemHandle.hpp>
 #include <is/systemhandle/RegisterSystem.hpp>
 #include <is/utils/Log.hpp>
 
 #include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -56,6 +61,29 @@ class InstanceHandle;
 using MiddlewarePrefixPathMap =
         std::unordered_map<std::string, std::vector<std::string> >;
 
+/**
+ * @struct DrainReport
+ * @brief Outcome of draining an *Integration Service* instance, per route.
+ *        Routes are identified as `topic:<name>` or `service:<name>`.
+ *
+ * @var DrainReport::complete
+ *      @brief Whether all the work in flight finished before the deadline.
+ *
+ * @var DrainReport::unfinished
+ *      @brief Messages still being forwarded and service calls still waiting for
+ *             their reply when the deadline expired. Only routes with unfinished work are listed.
+ *
+ * @var DrainReport::rejected
+ *      @brief Messages and requests received once the route was closed, which were discarded.
+ *             Only routes with rejected work are listed.
+ */
+struct DrainReport
+{
+    bool complete = true;
+    std::map<std::string, int64_t> unfinished;
+    std::map<std::string, uint64_t> rejected;
+};
+
 /**
  * @class Instance
  *        Base class for creating an *Integration Service* instance.
@@ -159,6 +187,22 @@ public:
      */
     InstanceHandle run();
 
+    /**
+     * @brief Starts the *Integration Service* instance without launching any thread,
+     *        so that the application drives it from its own event loop.
+     *
+     * @details The application must repeatedly call `InstanceHandle::poll_once()` from a single
+     *          thread, typically whenever `InstanceHandle::wait_handle()` becomes readable.
+     *          The `threads` of the `executor` section are ignored, and no signal handler
+     *          is installed, since the application owns both.
+     *
+     *          The same rules as in `run()` apply regarding the handles of an instance
+     *          that is already running.
+     *
+     * @returns An InstanceHandle to manage the embedded *Integration Service* instance.
+     */
+    InstanceHandle run_embedded();
+
     /**
      * @class Implementation
      *        Defines the actual implementation of the Instance class.
@@ -274,6 +318,56 @@ public:
      */
     InstanceHandle& quit();
 
+    /**
+     * @brief Runs one iteration of an instance started with `Instance::run_embedded()`.
+     *
+     * @details Spins once the systems that cannot be waited on, and then dispatches the
+     *          systems whose wait handle is readable. It only blocks, up to `timeout`,
+     *          when the former had nothing to do, so the timeout also bounds the latency
+     *          of those systems. It must always be called from the same thread.
+     *
+     * @param[in] timeout Maximum time to wait for some system to have work to do.
+     *
+     * @returns `true` while the instance keeps running, `false` once it has stopped,
+     *          or if it was not started with `Instance::run_embedded()`.
+     */
+    bool poll_once(
+            std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Gets a file descriptor that becomes readable whenever some event driven system
+     *        of an embedded instance has work to do, or `quit()` is called.
+     *
+     * @details It can be added to the `epoll` set, or wrapped in the event loop, of the
+     *          application, which should then call `poll_once()` with a zero timeout.
+     *          Systems that are not event driven never make it readable: if there are any,
+     *          `poll_once()` must also be called periodically.
+     *
+     * @returns The file descriptor, or `-1` if it is not available on this platform.
+     */
+    int wait_handle() const;
+
+    /**
+     * @brief Drains the instance and then instructs it to quit.
+     *
+     * @details Every topic and service stops accepting data, the requests waiting for their
+     *          batch to be complete are sent right away, and then it waits until the messages
+     *          being forwarded and the service calls waiting for their reply finish, or until
+     *          the timeout expires. Unlike `quit()`, this method blocks while draining.
+     *
+     *          If `drain_timeout_ms` is set in the `executor` section, sending `SIGTERM`
+     *          to the process drains the instance with that timeout.
+     *
+     *          On instances started with `Instance::run_embedded()`, it must be called from
+     *          the thread which calls `poll_once()`, since it polls the instance itself while waiting.
+     *
+     * @param[in] timeout Maximum time to wait for the work in flight.
+     *
+     * @returns A report with the work that was dropped.
+     */
+    DrainReport drain(
+            std::chrono::milliseconds timeout);
+
     /**
      * @brief Requests the TypeRegitry for a given middleware.
      *
@@ -284,6 +378,98 @@ public:
     const TypeRegistry* type_registry(
             const std::string& middleware_name);
 
+    /**
+     * @brief Reloads the `routes`, `topics` and `services` of the running instance,
+     *        without restarting its systems.
+     *
+     * @details The new configuration is compared against the running one: the topics and services
+     *          that disappeared or changed stop forwarding data, and the new or changed ones get
+     *          configured, while the rest keep running untouched.
+     *          The `systems` and `types` sections must not change, and the changes in the `executor`
+     *          section are only applied on restart.
+     *
+     *          A changed topic keeps the publishers of its destinations, which cannot be removed,
+     *          so it is rejected if it would need a publisher with another name, type or
+     *          middleware configuration from any of them.
+     *
+     *          Each system gets its routes changed between two of its spins, so this call waits for
+     *          the ongoing spins to finish. It must not be called from within a callback of a system.
+     *
+     *          If the instance was started from a config-file, sending `SIGHUP` to the process
+     *          reloads that file.
+     *
+     * @param[in] config_node The new *YAML* configuration.
+     *
+     * @returns `true` if the configuration was reloaded, `false` if it was rejected and the
+     *          instance keeps running with the previous one, or if some route could not be configured.
+     */
+    bool reload(
+            const YAML::Node& config_node);
+
+    /**
+     * @brief Gets the page faults suffered by the threads running the systems after their warm-up.
+     *
+     *        They are only monitored when the real-time mode is enabled in the `executor`
+     *        section of the configuration, and in that case they should stay at zero.
+     *
+     * @returns The number of page faults, always zero if the real-time mode is disabled.
+     */
+    uint64_t page_faults() const;
+
+    /**
+     * @brief Gets the throughput and latency figures of every topic and service configured
+     *        since the instance started, including those removed by a reload.
+     *
+     *        Reading them does not interfere with the routes, which keep updating them meanwhile.
+     *
+     * @returns The figures of each route, identified as `topic:<name>` or `service:<name>`.
+     */
+    std::map<std::string, RouteMetrics::Snapshot> metrics() const;
+
+    /**
+     * @brief Gets the figures of the latency probes configured in the `probes` section.
+     *
+     * @returns The figures of each probe, by name.
+     */
+    std::map<std::string, LatencyProbe::Snapshot> probes() const;
+
+    /**
+     * @brief Gets the port of the `metrics` endpoint, which is picked by the system
+     *        when the `port` given is zero.
+     *
+     * @returns The port, or zero if the instance does not serve metrics.
+     */
+    uint16_t metrics_port() const;
+
+    /**
+     * @brief Describes what the instance is doing: the systems it runs, how its topics
+     *        and services are routed, with which types and whether they need to be converted,
+     *        along with the live figures of each route and the depth of the queues.
+     *
+     *        It reflects the configuration currently running, including the reloaded one, if any.
+     *
+     * @returns The description of the instance.
+     */
+    Introspection introspect() const;
+
+    /**
+     * @brief Signature of the functions notified about the stalls of the systems.
+     *        They get the name of the stalled system and how long its current spin has lasted.
+     */
+    using StallCallback = std::function<void (const std::string& system, std::chrono::milliseconds duration)>;
+
+    /**
+     * @brief Sets the function notified whenever a system spends longer in a single spin than
+     *        the `stall_threshold_ms` of the `executor` section, replacing the previous one.
+     *
+     *        It is called once per stall, from a thread of its own, so a slow callback only delays
+     *        the next notifications, not the detection of the stalls, which are logged as warnings anyway.
+     *
+     * @param[in] callback The function to notify, or `nullptr` to stop notifying.
+     */
+    void on_stall(
+            StallCallback callback);
+
 private:
 
     friend class Instance::Implementation;
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef _IS_CORE_INTROSPECTION_HPP_
+#define _IS_CORE_INTROSPECTION_HPP_
+
+#include <is/core/runtime/LatencyHistogram.hpp>
+#include <is/core/runtime/RouteMetrics.hpp>
+#include <is/utils/MemoryTracker.hpp>
+
+#include <xtypes/xtypes.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @struct Introspection
+ * @brief Describes what a running *Integration Service* instance is doing:
+ *        which systems it runs, how its topics and services are routed, with which types,
+ *        and the live figures of each route.
+ *
+ * @var Introspection::systems
+ *      @brief The middleware type of each system, by name.
+ *
+ * @var Introspection::topics
+ *      @brief The topics being forwarded, by name.
+ *
+ * @var Introspection::services
+ *      @brief The services being forwarded, by name.
+ *
+ * @var Introspection::shard_queue_depths
+ *      @brief Messages waiting to be forwarded by each shard. Empty unless running in the sharded mode.
+ *
+ * @var Introspection::timer_tasks_pending
+ *      @brief Deferred route tasks waiting for their deadline.
+ *
+ * @var Introspection::spins
+ *      @brief The health of the spins of each system, by name.
+ *
+ * @var Introspection::memory
+ *      @brief Memory charged to each account, such as `topic:<name>`, `service:<name>`,
+ *             `system:<name>` or `types`. Empty unless the allocations are being tracked.
+ */
+struct Introspection
+{
+    /**
+     * @struct Endpoint
+     * @brief One of the sides of a route, once remapped.
+     *
+     * @var Endpoint::system
+     *      @brief Name of the system.
+     *
+     * @var Endpoint::name
+     *      @brief Name of the topic or service in the system.
+     *
+     * @var Endpoint::type
+     *      @brief Type of the messages, or of the requests, in the system.
+     *
+     * @var Endpoint::reply_type
+     *      @brief Type of the replies in the system. Empty for topics and services without reply.
+     */
+    struct Endpoint
+    {
+        std::string system;
+        std::string name;
+        std::string type;
+        std::string reply_type;
+    };
+
+    /**
+     * @struct Publication
+     * @brief How the data received from a source reaches a destination.
+     *
+     * @var Publication::from
+     *      @brief Name of the source system: a `from` system, or a client of a service.
+     *
+     * @var Publication::to
+     *      @brief Name of the destination system: a `to` system, or the server of a service.
+     *
+     * @var Publication::consistency
+     *      @brief Consistency between the types of both sides. Anything but `EQUALS`
+     *             means that every message, or request, gets converted on its way.
+     */
+    struct Publication
+    {
+        std::string from;
+        std::string to;
+        eprosima::xtypes::TypeConsistency consistency = eprosima::xtypes::TypeConsistency::EQUALS;
+    };
+
+    /**
+     * @struct Route
+     * @brief Describes a topic or a service.
+     *
+     * @var Route::sources
+     *      @brief Where the data comes from: the `from` systems, or the clients of the service.
+     *
+     * @var Route::destinations
+     *      @brief Where the data goes to: the `to` systems, or the server of the service.
+     *
+     * @var Route::publications
+     *      @brief Every combination of source and destination.
+     *
+     * @var Route::open
+     *      @brief Whether the route is accepting data.
+     *
+     * @var Route::in_flight
+     *      @brief Messages being forwarded and service calls waiting for their reply.
+     *
+     * @var Route::rejected
+     *      @brief Messages and requests received while the route was closed.
+     *
+     * @var Route::metrics
+     *      @brief Throughput and latency figures of the route.
+     */
+    struct Route
+    {
+        std::vector<Endpoint> sources;
+        std::vector<Endpoint> destinations;
+        std::vector<Publication> publications;
+        bool open = false;
+        int64_t in_flight = 0;
+        uint64_t rejected = 0;
+        RouteMetrics::Snapshot metrics;
+    };
+
+    /**
+     * @struct Spin
+     * @brief How long a system takes to spin.
+     *
+     * @var Spin::durations
+     *      @brief Duration of each spin of the system.
+     *
+     * @var Spin::stalls
+     *      @brief Spins that lasted longer than the stall threshold of the `executor` section.
+     *
+     * @var Spin::stalled
+     *      @brief Whether the system is stalled in its current spin.
+     */
+    struct Spin
+    {
+        LatencyHistogram::Snapshot durations;
+        uint64_t stalls = 0;
+        bool stalled = false;
+    };
+
+    std::map<std::string, std::string> systems;
+    std::map<std::string, Route> topics;
+    std::map<std::string, Route> services;
+    std::vector<std::size_t> shard_queue_depths;
+    std::size_t timer_tasks_pending = 0;
+    std::map<std::string, Spin> spins;
+    std::map<std::string, utils::MemoryTracker::Usage> memory;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_INTROSPECTION_HPP_
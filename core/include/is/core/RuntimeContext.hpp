@@ -0,0 +1,438 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_INTERNAL_RUNTIMECONTEXT_HPP_
+#define _IS_CORE_INTERNAL_RUNTIMECONTEXT_HPP_
+
+#include <is/core/runtime/LatencyProbe.hpp>
+#include <is/core/runtime/RouteMetrics.hpp>
+#include <is/core/runtime/ShardExecutor.hpp>
+#include <is/core/runtime/TimerQueue.hpp>
+#include <is/core/runtime/TopicDemand.hpp>
+#include <is/core/runtime/Tracer.hpp>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+namespace internal {
+
+/**
+ * @struct RouteState
+ * @brief State shared by every callback of a route.
+ *
+ *        Closing the route disables it without destroying the callbacks, which may still
+ *        be in use by the SystemHandle threads. The callbacks account for the work in flight,
+ *        so that the instance can wait for it before stopping.
+ *
+ * @var RouteState::open
+ *      @brief Whether the route accepts new messages or requests.
+ *
+ * @var RouteState::in_flight
+ *      @brief Messages being forwarded, and service calls waiting for their reply.
+ *
+ * @var RouteState::rejected
+ *      @brief Messages and requests discarded because the route was closed.
+ */
+struct RouteState
+{
+    std::atomic_bool open{true};
+    std::atomic<int64_t> in_flight{0};
+    std::atomic<uint64_t> rejected{0};
+
+    /**
+     * @brief Checks whether the route accepts new work, counting it as rejected otherwise.
+     *        Must be called once the work has been accounted for with an InFlightGuard.
+     */
+    bool accepts()
+    {
+        if (open.load())
+        {
+            return true;
+        }
+
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+};
+
+/**
+ * @class InFlightGuard
+ *        Accounts for a piece of work of a route while it is alive.
+ */
+class InFlightGuard
+{
+public:
+
+    explicit InFlightGuard(
+            RouteState& route)
+        : _route(route)
+    {
+        _route.in_flight.fetch_add(1);
+    }
+
+    InFlightGuard(
+            const InFlightGuard& /*other*/) = delete;
+
+    ~InFlightGuard()
+    {
+        _route.in_flight.fetch_sub(1);
+    }
+
+private:
+
+    RouteState& _route;
+};
+
+/**
+ * @struct Advertisement
+ * @brief A publisher produced by a destination system of a topic, along with what it was asked for.
+ *
+ *        Systems cannot remove their publishers, so they are kept for the whole life of the instance,
+ *        and reused whenever the topic gets configured again while reloading.
+ *
+ * @var Advertisement::topic
+ *      @brief Name of the topic in the system, once remapped.
+ *
+ * @var Advertisement::type_name
+ *      @brief Name of the type, once remapped.
+ *
+ * @var Advertisement::type
+ *      @brief The type given to the system. The reference keeps it alive along with the publisher.
+ *
+ * @var Advertisement::configuration
+ *      @brief The middleware-specific configuration given to the system, as *YAML* text.
+ *
+ * @var Advertisement::publisher
+ *      @brief The publisher itself.
+ */
+struct Advertisement
+{
+    std::string topic;
+    std::string type_name;
+    xtypes::DynamicType::Ptr type;
+    std::string configuration;
+    std::shared_ptr<TopicPublisher> publisher;
+
+    /**
+     * @brief Checks whether a publisher advertised as described by another Advertisement
+     *        would be the same as this one.
+     */
+    bool same_as(
+            const Advertisement& other) const
+    {
+        return topic == other.topic
+               && type_name == other.type_name
+               && configuration == other.configuration
+               && type && other.type
+               && type->is_compatible(*other.type) == xtypes::TypeConsistency::EQUALS;
+    }
+
+};
+
+/**
+ * @struct RuntimeContext
+ * @brief Holds the resources shared by the routes of a running *Integration Service* instance.
+ *
+ *        It is owned by the InstanceHandle and handed over to Config while the topics
+ *        and services get configured, so that the callbacks created there can rely
+ *        on it. It must outlive those callbacks and be stopped, through `stop()`,
+ *        before the SystemHandle instances get destroyed.
+ *
+ * @var RuntimeContext::timers
+ *      @brief Executes the deferred work of the routes, such as hedged service requests.
+ *
+ * @var RuntimeContext::shards
+ *      @brief Forwards the messages of the topics in the sharded mode, `nullptr` otherwise.
+ *
+ * @var RuntimeContext::tracer
+ *      @brief Records the spans of the sampled messages, `nullptr` if tracing is disabled.
+ *
+ * @var RuntimeContext::probes
+ *      @brief The latency probes of the instance. They are set up once, before running.
+ */
+struct RuntimeContext
+{
+    /**
+     * @brief Handle to the state of a route, shared by all its callbacks.
+     */
+    using RouteGate = std::shared_ptr<RouteState>;
+
+    RuntimeContext()
+        : timers("is-timers")
+    {
+    }
+
+    /**
+     * @brief Gets the key identifying a topic route in the gates.
+     */
+    static std::string topic_route(
+            const std::string& topic_name)
+    {
+        return "topic:" + topic_name;
+    }
+
+    /**
+     * @brief Gets the key identifying a service route in the gates.
+     */
+    static std::string service_route(
+            const std::string& service_name)
+    {
+        return "service:" + service_name;
+    }
+
+    /**
+     * @brief Opens a new gate for a route, closing the previous one, if any.
+     *
+     * @param[in] route The key of the route.
+     *
+     * @returns The new gate, already open.
+     */
+    RouteGate open_route(
+            const std::string& route)
+    {
+        RouteGate gate = std::make_shared<RouteState>();
+
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        RouteGate& current = _gates[route];
+        if (current)
+        {
+            current->open = false;
+        }
+        current = gate;
+        return gate;
+    }
+
+    /**
+     * @brief Closes the gate of a route, so that its callbacks stop forwarding data.
+     *
+     * @param[in] route The key of the route.
+     *
+     * @returns `true` if the route had a gate, `false` otherwise.
+     */
+    bool close_route(
+            const std::string& route)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        const auto it = _gates.find(route);
+        if (it == _gates.end())
+        {
+            return false;
+        }
+
+        it->second->open = false;
+        _gates.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Closes every route, keeping them to account for their work in flight.
+     */
+    void close_all_routes()
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        for (const auto& gate : _gates)
+        {
+            gate.second->open = false;
+        }
+    }
+
+    /**
+     * @brief Gets the gates of every route, by key.
+     */
+    std::map<std::string, RouteGate> routes() const
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        return _gates;
+    }
+
+    /**
+     * @brief Gets the metrics of a route, creating them the first time.
+     *        They are kept when the route gets reloaded, so that its figures keep adding up.
+     *
+     * @param[in] route The key of the route.
+     */
+    std::shared_ptr<RouteMetrics> route_metrics(
+            const std::string& route)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        std::shared_ptr<RouteMetrics>& metrics = _metrics[route];
+        if (!metrics)
+        {
+            metrics = std::make_shared<RouteMetrics>();
+        }
+        return metrics;
+    }
+
+    /**
+     * @brief Gets the metrics of every route, by key.
+     */
+    std::map<std::string, std::shared_ptr<RouteMetrics> > metrics() const
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        return _metrics;
+    }
+
+    /**
+     * @brief Registers the TopicDemand that switches the subscriptions of an on-demand topic,
+     *        so that removing the topic unsubscribes its sources through it.
+     */
+    void set_demand(
+            const std::string& route,
+            std::shared_ptr<TopicDemand> demand)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        _demands[route] = std::move(demand);
+    }
+
+    /**
+     * @brief Takes the TopicDemand of a route out of the context.
+     *
+     * @returns The TopicDemand, or `nullptr` if the route is not on demand.
+     */
+    std::shared_ptr<TopicDemand> take_demand(
+            const std::string& route)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        const auto it = _demands.find(route);
+        if (it == _demands.end())
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<TopicDemand> demand = std::move(it->second);
+        _demands.erase(it);
+        return demand;
+    }
+
+    /**
+     * @brief Gets the publisher produced by a system for a topic, the last time it was configured.
+     *
+     * @param[in] route The key of the route of the topic.
+     *
+     * @param[in] system The destination system.
+     *
+     * @param[out] advertisement The publisher, if found.
+     *
+     * @returns `true` if the system produced a publisher for the topic, `false` otherwise.
+     */
+    bool find_advertisement(
+            const std::string& route,
+            const std::string& system,
+            Advertisement& advertisement) const
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        const auto it = _advertisements.find(std::make_pair(route, system));
+        if (it == _advertisements.end())
+        {
+            return false;
+        }
+
+        advertisement = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Keeps the publisher produced by a system for a topic, so that it can be reused.
+     */
+    void add_advertisement(
+            const std::string& route,
+            const std::string& system,
+            Advertisement advertisement)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        _advertisements[std::make_pair(route, system)] = std::move(advertisement);
+    }
+
+    /**
+     * @brief Registers a function that sends right away the work that a route keeps queued,
+     *        such as the requests waiting for their batch to be complete.
+     */
+    void add_flusher(
+            std::function<void()> flusher)
+    {
+        std::lock_guard<std::mutex> lock(_gates_mtx);
+        _flushers.emplace_back(std::move(flusher));
+    }
+
+    /**
+     * @brief Calls every registered flusher.
+     */
+    void flush()
+    {
+        std::vector<std::function<void()> > flushers;
+        {
+            std::lock_guard<std::mutex> lock(_gates_mtx);
+            flushers = _flushers;
+        }
+
+        for (const auto& flusher : flushers)
+        {
+            flusher();
+        }
+    }
+
+    /**
+     * @brief Stops every background activity related to the routes.
+     */
+    void stop()
+    {
+        if (shards)
+        {
+            shards->stop();
+        }
+        timers.stop();
+    }
+
+    TimerQueue timers;
+
+    std::unique_ptr<ShardExecutor> shards;
+
+    std::unique_ptr<Tracer> tracer;
+
+    std::vector<std::shared_ptr<LatencyProbe> > probes;
+
+private:
+
+    mutable std::mutex _gates_mtx;
+
+    std::map<std::string, RouteGate> _gates;
+
+    std::map<std::string, std::shared_ptr<RouteMetrics> > _metrics;
+
+    std::map<std::string, std::shared_ptr<TopicDemand> > _demands;
+
+    std::map<std::pair<std::string, std::string>, Advertisement> _advertisements;
+
+    std::vector<std::function<void()> > _flushers;
+};
+
+} //  namespace internal
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_INTERNAL_RUNTIMECONTEXT_HPP_
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_LATENCYHISTOGRAM_HPP_
+#define _IS_CORE_RUNTIME_LATENCYHISTOGRAM_HPP_
+
+#include <is/core/export.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class LatencyHistogram
+ *        Lock-free histogram of durations, with logarithmic buckets in the style of HDR histograms.
+ *
+ *        Each power of two is split into 8 linear sub-buckets, so any recorded value is
+ *        reported with a relative error below 12.5%, from nanoseconds up to centuries,
+ *        with a fixed memory footprint. Recording is a couple of relaxed atomic increments,
+ *        so it can be done from any thread in the hot path. The sum and the maximum, which every
+ *        value updates, are split in cache line sized stripes like the counters of RouteMetrics.
+ */
+class IS_CORE_API LatencyHistogram
+{
+public:
+
+    /**
+     * @brief Number of sub-buckets in which each power of two is split, as a power of two.
+     */
+    static constexpr unsigned int SUB_BUCKET_BITS = 3;
+
+    /**
+     * @brief Total number of buckets.
+     */
+    static constexpr std::size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    /**
+     * @struct Snapshot
+     * @brief Copy of the contents of a histogram at some point.
+     *
+     * @var Snapshot::buckets
+     *      @brief Number of values recorded in each bucket.
+     *
+     * @var Snapshot::count
+     *      @brief Number of values recorded.
+     *
+     * @var Snapshot::sum
+     *      @brief Sum of the values recorded, in nanoseconds.
+     *
+     * @var Snapshot::max
+     *      @brief Maximum value recorded, in nanoseconds.
+     */
+    struct IS_CORE_API Snapshot
+    {
+        std::vector<uint64_t> buckets;
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        /**
+         * @brief Gets the value below which a fraction of the recorded values fall.
+         *
+         * @param[in] quantile The fraction, from 0 to 1.
+         *
+         * @returns The upper bound of the bucket holding the quantile, in nanoseconds,
+         *          or zero if nothing was recorded.
+         */
+        uint64_t percentile(
+                double quantile) const;
+
+        /**
+         * @brief Gets the mean of the recorded values, in nanoseconds.
+         */
+        double mean() const;
+
+        /**
+         * @brief Adds the contents of another snapshot to this one.
+         */
+        Snapshot& operator +=(
+                const Snapshot& other);
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief LatencyHistogram shall not be copy constructible.
+     */
+    LatencyHistogram(
+            const LatencyHistogram& /*other*/) = delete;
+
+    /**
+     * @brief Records a value.
+     *
+     * @param[in] nanoseconds The value to record.
+     */
+    void record(
+            uint64_t nanoseconds);
+
+    /**
+     * @brief Records a duration.
+     *
+     * @param[in] duration The duration to record. Negative durations are recorded as zero.
+     */
+    void record(
+            std::chrono::steady_clock::duration duration)
+    {
+        const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        record(static_cast<uint64_t>(nanoseconds > 0 ? nanoseconds : 0));
+    }
+
+    /**
+     * @brief Copies the current contents of the histogram. Values recorded concurrently
+     *        may or may not be included.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Gets the bucket where a value is recorded.
+     */
+    static std::size_t bucket_of(
+            uint64_t nanoseconds);
+
+    /**
+     * @brief Gets the highest value recorded in a bucket.
+     */
+    static uint64_t upper_bound(
+            std::size_t bucket);
+
+private:
+
+    /**
+     * Number of stripes of the sum and the maximum.
+     */
+    static constexpr std::size_t STRIPES = 16;
+
+    struct alignas(64) Stripe
+    {
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> max{0};
+    };
+
+    /**
+     * Gets the stripe of the calling thread, assigned in turns the first time it is needed.
+     */
+    static std::size_t stripe_index();
+
+    /**
+     * Class members.
+     */
+
+    std::array<std::atomic<uint64_t>, BUCKETS> _buckets;
+
+    std::array<Stripe, STRIPES> _stripes;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_LATENCYHISTOGRAM_HPP_
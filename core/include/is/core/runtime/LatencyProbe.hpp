@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef _IS_CORE_RUNTIME_LATENCYPROBE_HPP_
+#define _IS_CORE_RUNTIME_LATENCYPROBE_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/LatencyHistogram.hpp>
+#include <is/core/runtime/TimerQueue.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class LatencyProbe
+ *        Measures the end-to-end latency of a bridge, independently of the application traffic.
+ *
+ *        The sending side periodically publishes a synthetic message, stamped with the time
+ *        it was sent, into a system. The bridge under test carries it like any other message,
+ *        possibly through other instances, and the receiving side measures how long it took
+ *        to arrive. Both sides can live in the same instance or in different ones; in the
+ *        latter case, the probes are matched by name and the clocks of both hosts must be in sync.
+ *
+ *        The messages have the `is_probe` type, defined by the core:
+ *
+ *        ```idl
+ *        struct is_probe { string origin; uint64 sequence; int64 sent_ns; };
+ *        ```
+ */
+class IS_CORE_API LatencyProbe
+{
+public:
+
+    /**
+     * @brief Name of the type of the probe messages.
+     */
+    static constexpr const char* TYPE_NAME = "is_probe";
+
+    /**
+     * @brief IDL definition of the type of the probe messages.
+     */
+    static constexpr const char* TYPE_IDL =
+            "struct is_probe { string origin; uint64 sequence; int64 sent_ns; };";
+
+    /**
+     * @struct Snapshot
+     * @brief Copy of the figures of a probe at some point.
+     *
+     * @var Snapshot::sent
+     *      @brief Probe messages published by this side.
+     *
+     * @var Snapshot::received
+     *      @brief Probe messages received by this side.
+     *
+     * @var Snapshot::lost
+     *      @brief Probe messages that never arrived, judging by the gaps in their sequence.
+     *
+     * @var Snapshot::latency
+     *      @brief Time elapsed between the publication and the reception of each probe message.
+     */
+    struct Snapshot
+    {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+        uint64_t lost = 0;
+        LatencyHistogram::Snapshot latency;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] name Name of the probe. Only the probe messages sent with the same name are measured.
+     *
+     * @param[in] type The `is_probe` type.
+     */
+    LatencyProbe(
+            const std::string& name,
+            const xtypes::DynamicType& type);
+
+    /**
+     * @brief Destructor. Stops sending probe messages.
+     */
+    ~LatencyProbe() = default;
+
+    /**
+     * @brief Gets the name of the probe.
+     */
+    const std::string& name() const;
+
+    /**
+     * @brief Starts sending probe messages periodically.
+     *
+     * @param[in] publisher The publisher where the probe messages are sent.
+     *
+     * @param[in] period Time between two probe messages.
+     *
+     * @param[in] timers TimerQueue where the probe messages get scheduled.
+     *            It must outlive this object.
+     *
+     * @returns `false` if the TimerQueue was already stopped, `true` otherwise.
+     */
+    bool start(
+            std::shared_ptr<TopicPublisher> publisher,
+            std::chrono::milliseconds period,
+            TimerQueue& timers);
+
+    /**
+     * @brief Measures a received probe message. Messages sent by other probes are ignored.
+     *
+     * @param[in] message The received message, of the `is_probe` type.
+     */
+    void receive(
+            const xtypes::DynamicData& message);
+
+    /**
+     * @brief Copies the current figures of the probe.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the LatencyProbe class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of LatencyProbe.
+     *
+     *        It is shared with the scheduled probe messages.
+     */
+    class Implementation;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    std::shared_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_LATENCYPROBE_HPP_
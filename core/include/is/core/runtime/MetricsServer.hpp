@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_METRICSSERVER_HPP_
+#define _IS_CORE_RUNTIME_METRICSSERVER_HPP_
+
+#include <is/core/export.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class MetricsServer
+ *        Minimal HTTP listener that serves the metrics of an *Integration Service*
+ *        instance in the Prometheus text exposition format, under `/metrics`.
+ *
+ *        Requests are served one at a time from its own thread, so scraping never
+ *        runs on the threads of the routes: it only reads their atomic counters
+ *        through the render function. It is only available on Linux.
+ */
+class IS_CORE_API MetricsServer
+{
+public:
+
+    /**
+     * @brief Signature of the function that writes the metrics, in the Prometheus text format.
+     */
+    using Render = std::function<std::string ()>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] address IPv4 address to bind to, such as `127.0.0.1` to only accept local scrapers.
+     *
+     * @param[in] port TCP port to listen on. If zero, an ephemeral one is picked, see `port()`.
+     *
+     * @param[in] render Function called on each scrape to get the body of the response.
+     */
+    MetricsServer(
+            const std::string& address,
+            uint16_t port,
+            Render render);
+
+    /**
+     * @brief MetricsServer shall not be copy constructible.
+     */
+    MetricsServer(
+            const MetricsServer& /*other*/) = delete;
+
+    /**
+     * @brief Destructor. Calls `stop()`.
+     */
+    ~MetricsServer();
+
+    /**
+     * @brief Binds the listener and starts serving requests.
+     *
+     * @returns `false` if the address could not be bound, `true` otherwise.
+     */
+    bool start();
+
+    /**
+     * @brief Gets the port the listener is bound to, once started.
+     */
+    uint16_t port() const;
+
+    /**
+     * @brief Stops serving requests and closes the listener.
+     */
+    void stop();
+
+private:
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the MetricsServer class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of MetricsServer.
+     */
+    class Implementation;
+
+    /**
+     * Class members.
+     */
+
+    std::unique_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_METRICSSERVER_HPP_
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_REACTOR_HPP_
+#define _IS_CORE_RUNTIME_REACTOR_HPP_
+
+#include <is/core/export.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class Reactor
+ *        Waits on a set of file descriptors and dispatches the handler
+ *        associated to each one of them when it becomes readable.
+ *
+ *        It is used by the *Integration Service* core to run every EventDrivenSystem
+ *        on a single thread, calling into each SystemHandle only when it has work to do.
+ *        Descriptors are watched in level-triggered mode, so a handler that does not
+ *        consume all the pending work will be dispatched again straight away.
+ *
+ *        It is only available on Linux, where it is backed by `epoll`. Elsewhere,
+ *        `add()` always fails, so that callers can fall back to spinning.
+ */
+class IS_CORE_API Reactor
+{
+public:
+
+    /**
+     * @brief Signature of the handlers. They must return `false` upon failure.
+     */
+    using Handler = std::function<bool ()>;
+
+    /**
+     * @brief Constructor.
+     */
+    Reactor();
+
+    /**
+     * @brief Destructor.
+     */
+    ~Reactor();
+
+    /**
+     * @brief Starts watching a file descriptor.
+     *
+     * @param[in] fd The file descriptor. It must remain open while the Reactor is in use.
+     *
+     * @param[in] handler Function called every time `fd` is readable.
+     *
+     * @returns `true` if the descriptor is now being watched, `false` otherwise.
+     */
+    bool add(
+            int fd,
+            Handler handler);
+
+    /**
+     * @brief Waits until a descriptor is readable, and dispatches the handlers
+     *        of every readable descriptor.
+     *
+     * @param[in] timeout Maximum time to wait.
+     *
+     * @returns `false` if some handler failed, or the wait itself failed; `true` otherwise,
+     *          even if the timeout expired without any handler being dispatched.
+     */
+    bool run_once(
+            std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Interrupts an ongoing `run_once()` call, from any thread.
+     */
+    void wake_up();
+
+    /**
+     * @brief Gets the number of descriptors being watched.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets a file descriptor that becomes readable whenever `run_once()`
+     *        has work to do, so that the Reactor itself can be waited on.
+     *
+     * @returns The descriptor, or `-1` if it is not available.
+     */
+    int wait_handle() const;
+
+private:
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the Reactor class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of Reactor.
+     */
+    class Implementation;
+
+    /**
+     * Class members.
+     */
+
+    std::unique_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_REACTOR_HPP_
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_REALTIME_HPP_
+#define _IS_CORE_RUNTIME_REALTIME_HPP_
+
+#include <is/core/export.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @struct RealtimeSettings
+ * @brief Process wide settings of the real-time execution mode.
+ *
+ *        When enabled, the memory of the process is locked and pre-faulted before the
+ *        systems start spinning, and the spinning threads monitor the page faults that
+ *        they suffer once the warm-up period is over. Thread priorities are configured
+ *        separately, per thread, through ThreadSettings.
+ *
+ *        Only supported on Linux.
+ *
+ * @var RealtimeSettings::enabled
+ *      @brief Whether the real-time mode is enabled.
+ *
+ * @var RealtimeSettings::lock_memory
+ *      @brief Locks the current and future memory of the process in RAM, using `mlockall`.
+ *
+ * @var RealtimeSettings::prefault_stack
+ *      @brief Bytes of stack touched by each spinning thread when it starts.
+ *
+ * @var RealtimeSettings::prefault_heap
+ *      @brief Bytes of heap reserved and touched before starting. With `glibc`, they are
+ *             kept by the allocator afterwards, so that later allocations do not fault.
+ *
+ * @var RealtimeSettings::fail_on_page_fault
+ *      @brief Stops the instance if a spinning thread suffers a page fault after the warm-up.
+ *
+ * @var RealtimeSettings::warmup
+ *      @brief Time given to the spinning threads to fault in their working set.
+ */
+struct IS_CORE_API RealtimeSettings
+{
+    bool enabled = false;
+    bool lock_memory = true;
+    std::size_t prefault_stack = 256 * 1024;
+    std::size_t prefault_heap = 0;
+    bool fail_on_page_fault = false;
+    std::chrono::milliseconds warmup = std::chrono::milliseconds(1000);
+
+    /**
+     * @brief Applies the process wide settings: memory locking and heap pre-faulting.
+     *
+     * @returns `true` if every setting was applied, `false` otherwise.
+     */
+    bool apply_to_process() const;
+
+    /**
+     * @brief Touches `prefault_stack` bytes of the stack of the calling thread.
+     *
+     *        The size is clamped to the stack left to the thread, with a warning.
+     */
+    void prefault_current_stack() const;
+};
+
+/**
+ * @class PageFaultMonitor
+ *        Counts the page faults suffered by the thread that created it.
+ *
+ *        It must only be used by that thread.
+ */
+class IS_CORE_API PageFaultMonitor
+{
+public:
+
+    /**
+     * @brief Constructor. Takes the current page fault count of the calling thread as baseline.
+     */
+    PageFaultMonitor();
+
+    /**
+     * @brief Gets the page faults, both minor and major, suffered since the previous call.
+     *
+     * @returns The number of new page faults. Always zero on platforms other than Linux.
+     */
+    uint64_t poll();
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    uint64_t _last;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_REALTIME_HPP_
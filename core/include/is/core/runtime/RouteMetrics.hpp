@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_ROUTEMETRICS_HPP_
+#define _IS_CORE_RUNTIME_ROUTEMETRICS_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/LatencyHistogram.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class RouteMetrics
+ *        Throughput and latency figures of a topic or service route.
+ *
+ *        The counters are split in cache line sized stripes, and every thread
+ *        always updates the same stripe, so that the middleware threads feeding
+ *        a busy route do not contend on the same cache line. They are only
+ *        added together when read.
+ */
+class IS_CORE_API RouteMetrics
+{
+public:
+
+    /**
+     * @struct Snapshot
+     * @brief Copy of the figures of a route at some point.
+     *
+     * @var Snapshot::messages
+     *      @brief Messages, or requests, forwarded by the route.
+     *
+     * @var Snapshot::dropped
+     *      @brief Messages, or requests, discarded by the route: because it was closed,
+     *             because nobody was subscribed to the topic, or because its shard was stopped.
+     *
+     * @var Snapshot::conversion
+     *      @brief Time spent converting the messages into the type of each destination.
+     *             Only destinations whose type is not equal to the source's are measured.
+     *
+     * @var Snapshot::publish
+     *      @brief Time spent handing each message over to each destination.
+     */
+    struct Snapshot
+    {
+        uint64_t messages = 0;
+        uint64_t dropped = 0;
+        LatencyHistogram::Snapshot conversion;
+        LatencyHistogram::Snapshot publish;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    RouteMetrics();
+
+    /**
+     * @brief RouteMetrics shall not be copy constructible.
+     */
+    RouteMetrics(
+            const RouteMetrics& /*other*/) = delete;
+
+    /**
+     * @brief Accounts for a message accepted by the route.
+     */
+    void message()
+    {
+        local_stripe().messages.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Accounts for a message discarded by the route.
+     */
+    void dropped()
+    {
+        local_stripe().dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the histogram of the conversion times.
+     */
+    LatencyHistogram& conversion()
+    {
+        return _conversion;
+    }
+
+    /**
+     * @brief Gets the histogram of the publication times.
+     */
+    LatencyHistogram& publish()
+    {
+        return _publish;
+    }
+
+    /**
+     * @brief Copies the current figures of the route.
+     */
+    Snapshot snapshot() const;
+
+private:
+
+    /**
+     * Number of stripes of the counters.
+     */
+    static constexpr std::size_t STRIPES = 16;
+
+    struct alignas(64) Stripe
+    {
+        std::atomic<uint64_t> messages{0};
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    Stripe& local_stripe()
+    {
+        return _stripes[stripe_index()];
+    }
+
+    /**
+     * Gets the stripe of the calling thread, assigned in turns the first time it is needed.
+     */
+    static std::size_t stripe_index();
+
+    /**
+     * Class members.
+     */
+
+    std::array<Stripe, STRIPES> _stripes;
+
+    LatencyHistogram _conversion;
+
+    LatencyHistogram _publish;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_ROUTEMETRICS_HPP_
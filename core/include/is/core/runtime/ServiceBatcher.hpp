@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SERVICEBATCHER_HPP_
+#define _IS_CORE_RUNTIME_SERVICEBATCHER_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/TimerQueue.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class ServiceBatcher
+ *        Groups the concurrent requests of a service, to forward them to the
+ *        ServiceProvider with a single `ServiceProvider::call_service_batch` call.
+ *
+ *        The first request of a batch opens a window of the configured duration.
+ *        The batch is sent when the window expires, or as soon as it reaches its
+ *        maximum size, whatever happens first.
+ */
+class IS_CORE_API ServiceBatcher
+{
+public:
+
+    /**
+     * @struct Policy
+     * @brief Configures how requests are grouped.
+     *
+     * @var Policy::window
+     *      @brief Maximum time that a request waits for others to join its batch.
+     *
+     * @var Policy::max_size
+     *      @brief Maximum number of requests per batch.
+     *             It must be at least 1, which the configuration parser checks.
+     */
+    struct Policy
+    {
+        std::chrono::microseconds window = std::chrono::microseconds(1000);
+        std::size_t max_size = 32;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] service_name Name of the batched service, used for logging purposes.
+     *
+     * @param[in] policy The batching policy.
+     *
+     * @param[in] provider The ServiceProvider that will serve the batches.
+     *
+     * @param[in] timers TimerQueue where the expiration of the windows will be scheduled.
+     *            It must outlive this object.
+     */
+    ServiceBatcher(
+            const std::string& service_name,
+            const Policy& policy,
+            std::shared_ptr<ServiceProvider> provider,
+            TimerQueue& timers);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ServiceBatcher() = default;
+
+    /**
+     * @brief Adds a request to the current batch of the service.
+     *
+     * @param[in] request Request message for the service. It is copied into the batch.
+     *
+     * @param[in] client The proxy for the client that is making the request.
+     *
+     * @param[in] call_handle The handle given by the client for this call.
+     */
+    void call_service(
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle);
+
+    /**
+     * @brief Sends the current batch right away, without waiting for its window to expire.
+     *        Used when the instance gets drained.
+     */
+    void flush();
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the ServiceBatcher class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of ServiceBatcher.
+     *
+     *        It is shared with the scheduled window expirations.
+     */
+    class Implementation;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    std::shared_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SERVICEBATCHER_HPP_
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SERVICECALLTRACKER_HPP_
+#define _IS_CORE_RUNTIME_SERVICECALLTRACKER_HPP_
+
+#include <is/core/export.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class ServiceCallTracker
+ *        ServiceClient proxy that counts the calls of a service route
+ *        which are still waiting for their response.
+ *
+ *        It is created by the *Integration Service* core, once per service route,
+ *        so that a draining instance can wait for the outstanding calls before stopping.
+ *        A call stops being counted when its response is delivered, or when the
+ *        provider releases its handle without answering.
+ */
+class IS_CORE_API ServiceCallTracker : public ServiceClient
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] in_flight Counter of the work in flight of the route.
+     *            It is incremented by `wrap()`, and decremented once each call finishes.
+     */
+    ServiceCallTracker(
+            std::shared_ptr<std::atomic<int64_t> > in_flight);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ServiceCallTracker() override = default;
+
+    /**
+     * @brief Starts tracking a call.
+     *
+     *        The returned handle must be passed to `ServiceProvider::call_service`,
+     *        along with this object, instead of the original client and handle.
+     *
+     * @param[in] client The proxy for the client that is making the request.
+     *
+     * @param[in] call_handle The handle given by the client for this call.
+     *
+     * @param[in] on_response Optional function called once the first response
+     *            of the call has been delivered to the client.
+     *
+     * @returns The call handle to use with this proxy.
+     */
+    std::shared_ptr<void> wrap(
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle,
+            std::function<void()> on_response = nullptr) const;
+
+    /**
+     * @brief Inherited from ServiceClient.
+     *
+     *        Stops tracking the call and forwards the response to the client given to `wrap()`.
+     */
+    void receive_response(
+            std::shared_ptr<void> call_handle,
+            const xtypes::DynamicData& response) override;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    std::shared_ptr<std::atomic<int64_t> > _in_flight;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SERVICECALLTRACKER_HPP_
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SERVICEHEDGING_HPP_
+#define _IS_CORE_RUNTIME_SERVICEHEDGING_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/TimerQueue.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class ServiceHedging
+ *        Sends hedged requests for a service, to cut its tail latency.
+ *
+ *        Each request is first forwarded to the ServiceProvider as usual. If no
+ *        response has arrived after the configured percentile of the latencies
+ *        observed for the service, the very same request is sent again.
+ *        Whichever response comes first is delivered to the ServiceClient that
+ *        made the request, through `ServiceClient::receive_response`; the late
+ *        ones are discarded.
+ *
+ *        This should only be enabled for services whose requests can be safely
+ *        repeated, because the ServiceProvider may end up executing them twice.
+ */
+class IS_CORE_API ServiceHedging
+{
+public:
+
+    /**
+     * @struct Policy
+     * @brief Configures when hedged requests are sent.
+     *
+     * @var Policy::percentile
+     *      @brief Percentile of the observed latencies after which the request is hedged.
+     *             It must be in the range (0, 100], which the configuration parser checks.
+     *
+     * @var Policy::initial_delay
+     *      @brief Delay used until enough latency samples have been collected.
+     *
+     * @var Policy::min_delay
+     *      @brief Lower bound for the delay, to avoid hedging almost every request.
+     *
+     * @var Policy::window
+     *      @brief Number of recent latency samples used to compute the percentile.
+     *
+     * @var Policy::min_samples
+     *      @brief Number of samples required before using the percentile instead of `initial_delay`.
+     */
+    struct Policy
+    {
+        double percentile = 95.0;
+        std::chrono::microseconds initial_delay = std::chrono::milliseconds(100);
+        std::chrono::microseconds min_delay = std::chrono::milliseconds(1);
+        std::size_t window = 256;
+        std::size_t min_samples = 16;
+    };
+
+    /**
+     * @struct Statistics
+     * @brief Counters describing the hedging activity of a service.
+     *
+     * @var Statistics::requests
+     *      @brief Requests received from the clients.
+     *
+     * @var Statistics::hedged
+     *      @brief Requests for which a hedged request was sent.
+     *
+     * @var Statistics::hedge_wins
+     *      @brief Requests answered first by the hedged request.
+     */
+    struct Statistics
+    {
+        uint64_t requests;
+        uint64_t hedged;
+        uint64_t hedge_wins;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] service_name Name of the hedged service, used for logging purposes.
+     *
+     * @param[in] policy The hedging policy.
+     *
+     * @param[in] timers TimerQueue where the hedged requests will be scheduled.
+     *            It must outlive this object and the requests made through it.
+     */
+    ServiceHedging(
+            const std::string& service_name,
+            const Policy& policy,
+            TimerQueue& timers);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ServiceHedging() = default;
+
+    /**
+     * @brief Calls a service, sending a hedged request if the response takes too long.
+     *
+     * @param[in] provider The ServiceProvider that will serve the request.
+     *
+     * @param[in] request Request message for the service. It is copied, so that it
+     *            can be sent again later on.
+     *
+     * @param[in] client The proxy for the client that is making the request.
+     *
+     * @param[in] call_handle The handle given by the client for this call. It will
+     *            be passed back to the client when the first response arrives.
+     */
+    void call_service(
+            const std::shared_ptr<ServiceProvider>& provider,
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle);
+
+    /**
+     * @brief Gets the time that a request is currently allowed to wait before being hedged.
+     *
+     * @returns The current hedging delay.
+     */
+    std::chrono::nanoseconds hedge_delay() const;
+
+    /**
+     * @brief Gets the hedging counters for this service.
+     *
+     * @returns A copy of the current Statistics.
+     */
+    Statistics statistics() const;
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the ServiceHedging class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of ServiceHedging.
+     *
+     *        It is shared with the requests in flight, so that they can record their latency
+     *        even if they finish after the ServiceHedging instance is gone.
+     */
+    class Implementation;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    std::shared_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SERVICEHEDGING_HPP_
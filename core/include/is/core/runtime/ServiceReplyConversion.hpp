@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SERVICEREPLYCONVERSION_HPP_
+#define _IS_CORE_RUNTIME_SERVICEREPLYCONVERSION_HPP_
+
+#include <is/core/export.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <memory>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class ServiceReplyConversion
+ *        ServiceClient proxy that converts the responses of a service into the
+ *        reply type expected by the client, before delivering them.
+ *
+ *        It is created by the *Integration Service* core, once per client route
+ *        whose reply type is compatible with the server's one, but not equal to it.
+ *        The target type is resolved when the route gets configured, so the only
+ *        work left per response is the conversion itself. This way, SystemHandle
+ *        implementations always receive responses of their own reply type in
+ *        `ServiceClient::receive_response`, as it happens with requests
+ *        in `ServiceProvider::call_service`.
+ */
+class IS_CORE_API ServiceReplyConversion : public ServiceClient
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] client_reply_type The reply type of the client. It must outlive this object.
+     */
+    ServiceReplyConversion(
+            const xtypes::DynamicType& client_reply_type);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ServiceReplyConversion() override = default;
+
+    /**
+     * @brief Prepares a call so that its response gets converted by this proxy.
+     *
+     *        The returned handle must be passed to `ServiceProvider::call_service`,
+     *        along with this object, instead of the original client and handle.
+     *
+     * @param[in] client The proxy for the client that is making the request.
+     *
+     * @param[in] call_handle The handle given by the client for this call.
+     *
+     * @returns The call handle to use with this proxy.
+     */
+    std::shared_ptr<void> wrap(
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle) const;
+
+    /**
+     * @brief Inherited from ServiceClient.
+     *
+     *        Converts the response and forwards it to the client given to `wrap()`.
+     */
+    void receive_response(
+            std::shared_ptr<void> call_handle,
+            const xtypes::DynamicData& response) override;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    const xtypes::DynamicType& _client_reply_type;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SERVICEREPLYCONVERSION_HPP_
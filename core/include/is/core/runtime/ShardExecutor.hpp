@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SHARDEXECUTOR_HPP_
+#define _IS_CORE_RUNTIME_SHARDEXECUTOR_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/ThreadSettings.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class ShardExecutor
+ *        Runs the routes of an *Integration Service* instance on a fixed set of threads,
+ *        usually one per core, each of them owning a shard of the routes.
+ *
+ *        Every route is always forwarded by the same shard, so the state of a route is only
+ *        touched by one thread. The middleware threads hand their messages over to the shard
+ *        through lock-free single producer, single consumer queues: each producer thread
+ *        gets its own queue towards each shard, so no lock is taken on the hot path.
+ *        The queues of a thread are dropped once it finishes and they are empty.
+ */
+class IS_CORE_API ShardExecutor
+{
+public:
+
+    /**
+     * @brief Signature of the work handed over to a shard.
+     */
+    using Task = std::function<void ()>;
+
+    /**
+     * @brief Constructor. Launches the threads of the shards.
+     *
+     * @param[in] shards Settings of the thread of each shard. There is one shard per entry.
+     *
+     * @param[in] queue_capacity Capacity of each queue between a producer thread and a shard.
+     */
+    ShardExecutor(
+            const std::vector<ThreadSettings>& shards,
+            std::size_t queue_capacity);
+
+    /**
+     * @brief ShardExecutor shall not be copy constructible.
+     */
+    ShardExecutor(
+            const ShardExecutor& /*other*/) = delete;
+
+    /**
+     * @brief Destructor. Calls `stop()`.
+     */
+    ~ShardExecutor();
+
+    /**
+     * @brief Gets the number of shards.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets the shard that owns a route.
+     *
+     * @param[in] route The key of the route.
+     *
+     * @returns The index of the shard, always the same for the same key.
+     */
+    std::size_t shard_of(
+            const std::string& route) const;
+
+    /**
+     * @brief Hands a task over to a shard. If the queue of the calling thread towards
+     *        the shard is full, it waits until the shard makes room, unless the calling thread
+     *        is itself a shard, which could be waited for by the other one.
+     *
+     * @param[in] shard Index of the shard, as given by `shard_of()`.
+     *
+     * @param[in] task The task to be executed by the shard.
+     *
+     * @returns `false` if the executor has already been stopped, or if a shard found the queue full,
+     *          in which case the task is dropped. `true` otherwise.
+     */
+    bool post(
+            std::size_t shard,
+            Task task);
+
+    /**
+     * @brief Gets the number of tasks waiting in the queues of each shard.
+     *        It only reads counters, so the figures of busy shards are only approximate.
+     */
+    std::vector<std::size_t> queue_depths() const;
+
+    /**
+     * @brief Stops the shards, once they have executed the tasks already handed over to them.
+     *
+     *        Once stopped, new tasks will be rejected.
+     */
+    void stop();
+
+private:
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the ShardExecutor class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of ShardExecutor.
+     */
+    class Implementation;
+
+    /**
+     * Class members.
+     */
+
+    std::unique_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SHARDEXECUTOR_HPP_
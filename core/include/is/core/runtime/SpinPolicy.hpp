@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_SPINPOLICY_HPP_
+#define _IS_CORE_RUNTIME_SPINPOLICY_HPP_
+
+#include <is/core/export.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @struct SpinPolicy
+ * @brief Describes what a spinning thread does when its SystemHandles had nothing to do,
+ *        trading CPU usage for latency.
+ *
+ * @var SpinPolicy::kind
+ *      @brief The strategy to follow.
+ *
+ * @var SpinPolicy::max_backoff
+ *      @brief For `ADAPTIVE_BACKOFF`, the longest time to sleep between two idle spins.
+ *
+ * @var SpinPolicy::block_timeout
+ *      @brief For `BLOCKING`, the longest time to wait for new work before spinning again.
+ *             It is rounded up to whole milliseconds while waiting on wait handles.
+ */
+struct IS_CORE_API SpinPolicy
+{
+    /**
+     * @brief Available strategies.
+     */
+    enum class Kind
+    {
+        BUSY_POLL,          //  Spins again right away. Lowest latency, one full core per thread.
+        YIELD,              //  Yields the CPU to other threads before spinning again.
+        ADAPTIVE_BACKOFF,   //  Polls, then yields, then sleeps increasingly longer while idle.
+        BLOCKING            //  Waits for the wait handles of the systems, or sleeps if there is none.
+    };
+
+    Kind kind = Kind::ADAPTIVE_BACKOFF;
+    std::chrono::microseconds max_backoff = std::chrono::microseconds(1000);
+    std::chrono::microseconds block_timeout = std::chrono::microseconds(10000);
+
+    /**
+     * @brief Gets the Kind named by a string, as written in the *YAML* configuration.
+     *
+     * @param[in] name The name: `busy_poll`, `yield`, `adaptive_backoff` or `blocking`.
+     *
+     * @param[out] kind The corresponding Kind, if found.
+     *
+     * @returns `true` if the name is valid, `false` otherwise.
+     */
+    static bool kind_from_string(
+            const std::string& name,
+            Kind& kind);
+};
+
+/**
+ * @class SpinStrategy
+ *        Applies a SpinPolicy to a spinning thread.
+ *
+ *        The thread must call `worked()` or `idle()` after each spin, depending on
+ *        whether there was something to do. It is not thread safe: each spinning
+ *        thread must own its instance.
+ */
+class IS_CORE_API SpinStrategy
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] policy The policy to apply.
+     *
+     * @param[in] wait_handles File descriptors that become readable when there is new work,
+     *            used by the `BLOCKING` policy, which waits until any of them is readable.
+     *            Empty if not available, in which case `BLOCKING` sleeps instead.
+     */
+    SpinStrategy(
+            const SpinPolicy& policy,
+            std::vector<int> wait_handles = {});
+
+    /**
+     * @brief Notifies that the last spin did some work, resetting the backoff.
+     */
+    void worked();
+
+    /**
+     * @brief Notifies that the last spin had nothing to do, and waits as dictated by the policy.
+     */
+    void idle();
+
+    /**
+     * @brief Gets the longest time that the next `idle()` call may wait.
+     *
+     * @returns The time, which is zero if it only polls or yields.
+     */
+    std::chrono::microseconds next_wait() const;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    const SpinPolicy _policy;
+
+#ifdef __linux__
+    /**
+     * The wait handles, ready to be passed to `poll`, so that waiting does not allocate.
+     */
+    std::vector<pollfd> _poll_fds;
+#endif //  __linux__
+
+    uint32_t _idle_spins;
+
+    std::chrono::microseconds _backoff;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_SPINPOLICY_HPP_
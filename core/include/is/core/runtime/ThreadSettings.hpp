@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_THREADSETTINGS_HPP_
+#define _IS_CORE_RUNTIME_THREADSETTINGS_HPP_
+
+#include <is/core/export.hpp>
+
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @struct ThreadSettings
+ * @brief Operating system settings for the threads launched by the *Integration Service* core.
+ *
+ * @var ThreadSettings::name
+ *      @brief Name of the thread, as shown by debuggers and system tools.
+ *             Linux truncates it to 15 characters. Left unchanged if empty.
+ *
+ * @var ThreadSettings::cpus
+ *      @brief CPUs where the thread is allowed to run. Left unchanged if empty.
+ *
+ * @var ThreadSettings::priority
+ *      @brief Real-time priority of the thread, from 1 to 99, under the `SCHED_FIFO` policy.
+ *             The thread keeps the default scheduling policy if it is zero.
+ *
+ * @var ThreadSettings::numa_node
+ *      @brief NUMA node where the thread runs and, preferably, allocates its memory.
+ *             If `cpus` is empty, the thread is pinned to all the CPUs of the node.
+ *             Ignored if negative.
+ */
+struct IS_CORE_API ThreadSettings
+{
+    std::string name;
+    std::vector<int> cpus;
+    int priority = 0;
+    int numa_node = -1;
+
+    /**
+     * @brief Applies these settings to the calling thread.
+     *
+     *        Each failing setting is logged, and the remaining ones are still applied.
+     *        Only supported on Linux; on other platforms, nothing is done.
+     *
+     * @returns `true` if every setting was applied, `false` otherwise.
+     */
+    bool apply() const;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_THREADSETTINGS_HPP_
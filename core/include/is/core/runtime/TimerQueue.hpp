@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_TIMERQUEUE_HPP_
+#define _IS_CORE_RUNTIME_TIMERQUEUE_HPP_
+
+#include <is/core/export.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class TimerQueue
+ *        Executes deferred tasks on a single background thread, in deadline order.
+ *
+ *        It is used by the *Integration Service* core for every route feature that
+ *        needs to act some time after a message or request went through, such as
+ *        hedged service requests. The background thread is only launched when
+ *        the first task gets scheduled, so instances that never use it have no cost.
+ *
+ *        Tasks must be short and non-blocking, since they all share the same thread.
+ */
+class IS_CORE_API TimerQueue
+{
+public:
+
+    /**
+     * @brief Signature of the tasks that can be scheduled.
+     */
+    using Task = std::function<void ()>;
+
+    /**
+     * @brief Clock used to compute the deadlines.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] name Name given to the background thread, for debugging purposes.
+     */
+    TimerQueue(
+            const std::string& name = "is-timers");
+
+    /**
+     * @brief TimerQueue shall not be copy constructible.
+     */
+    TimerQueue(
+            const TimerQueue& /*other*/) = delete;
+
+    /**
+     * @brief Destructor. Calls `stop()`.
+     */
+    ~TimerQueue();
+
+    /**
+     * @brief Schedules a task to be executed once the deadline is reached.
+     *
+     * @param[in] deadline The moment in which the task should be executed.
+     *
+     * @param[in] task The task to be executed.
+     *
+     * @returns `false` if the queue has already been stopped, `true` otherwise.
+     */
+    bool schedule(
+            Clock::time_point deadline,
+            Task task);
+
+    /**
+     * @brief Schedules a task to be executed after a certain delay.
+     *
+     * @param[in] delay Time to wait, starting now, before executing the task.
+     *
+     * @param[in] task The task to be executed.
+     *
+     * @returns `false` if the queue has already been stopped, `true` otherwise.
+     */
+    bool schedule_after(
+            Clock::duration delay,
+            Task task);
+
+    /**
+     * @brief Gets the number of tasks waiting for their deadline.
+     *
+     * @returns The amount of pending tasks.
+     */
+    std::size_t pending() const;
+
+    /**
+     * @brief Stops the background thread. Pending tasks are discarded without being executed.
+     *
+     *        Once stopped, new tasks will be rejected. It can be called from a task,
+     *        which can even destroy the queue: the background thread then finishes on its own
+     *        once the task returns.
+     */
+    void stop();
+
+private:
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the TimerQueue class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of TimerQueue.
+     *
+     *        Methods named equal to some TimerQueue method will not be
+     *        documented again. Usually, the interface class will call
+     *        `_pimpl->method()`, but the functionality and parameters
+     *        are exactly the same.
+     */
+    class Implementation;
+
+    /**
+     * Class members.
+     */
+
+    std::unique_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_TIMERQUEUE_HPP_
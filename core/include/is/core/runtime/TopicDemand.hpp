@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_TOPICDEMAND_HPP_
+#define _IS_CORE_RUNTIME_TOPICDEMAND_HPP_
+
+#include <is/core/export.hpp>
+#include <is/core/runtime/TimerQueue.hpp>
+#include <is/systemhandle/SystemHandle.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class TopicDemand
+ *        Keeps the sources of a topic subscribed only while at least one of its
+ *        destination publishers has matched subscribers.
+ *
+ *        The publishers report their matched subscribers through
+ *        `TopicPublisher::set_matched_callback`; those not supporting it are
+ *        considered to always have subscribers. The sources are switched on and off
+ *        from the TimerQueue thread, so that the middlewares are never asked to
+ *        subscribe from within their own callbacks.
+ */
+class IS_CORE_API TopicDemand
+{
+public:
+
+    /**
+     * @brief Signature of the function that subscribes a source to the topic, when called
+     *        with `true`, or unsubscribes it, when called with `false`.
+     *        It returns whether the operation succeeded.
+     */
+    using Source = std::function<bool (bool subscribe)>;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] topic_name Name of the topic, used for logging purposes.
+     *
+     * @param[in] gate Flag telling whether the topic is still configured. Once it gets
+     *            cleared, the sources are never subscribed again.
+     *
+     * @param[in] timers TimerQueue where the sources get switched. It must outlive this object.
+     */
+    TopicDemand(
+            const std::string& topic_name,
+            std::shared_ptr<std::atomic_bool> gate,
+            TimerQueue& timers);
+
+    /**
+     * @brief Registers a destination of the topic, and starts following its matched subscribers.
+     *
+     * @param[in] publisher The publisher of the destination.
+     */
+    void add_publisher(
+            TopicPublisher& publisher);
+
+    /**
+     * @brief Registers a source of the topic. It is not subscribed until `start()` is called.
+     *
+     * @param[in] source The function that switches the subscription of the source.
+     *            It runs on the TimerQueue thread while the system keeps spinning, so it
+     *            must wait for the ongoing spin of the system to finish, as required by
+     *            the threading contract of SystemHandle.
+     */
+    void add_source(
+            Source source);
+
+    /**
+     * @brief Subscribes the sources if there is demand for the topic. From then on,
+     *        they are switched whenever the demand changes.
+     *
+     * @returns `false` if some source could not be subscribed, `true` otherwise.
+     */
+    bool start();
+
+    /**
+     * @brief Unsubscribes the sources for good, once the gate of the topic has been cleared.
+     *
+     *        Each source is asked to unsubscribe at most once, whether from here or because
+     *        the demand dropped before.
+     *
+     * @returns `true` if no source remains subscribed, `false` if some of them could not unsubscribe.
+     */
+    bool stop();
+
+    /**
+     * @brief Checks whether some destination has matched subscribers.
+     *        The sources that cannot unsubscribe use it to discard the messages early.
+     */
+    bool active() const;
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the TopicDemand class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of TopicDemand.
+     *
+     *        It is shared with the matched callbacks of the publishers.
+     */
+    class Implementation;
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    std::shared_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_TOPICDEMAND_HPP_
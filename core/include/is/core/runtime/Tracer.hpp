@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_CORE_RUNTIME_TRACER_HPP_
+#define _IS_CORE_RUNTIME_TRACER_HPP_
+
+#include <is/core/export.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+/**
+ * @class Tracer
+ *        Writes the spans of a sample of the messages and requests going through the routes
+ *        to a local file, in the Chrome trace event format, so that they can be inspected
+ *        with `chrome://tracing` or Perfetto.
+ *
+ *        All the spans of the same message share its trace identifier. Their timestamps come
+ *        from the system clock, so that the files written by several instances along a chain
+ *        of bridges can be loaded together. The spans are written from a background thread;
+ *        the routes only append them to a buffer, and only for the sampled messages.
+ *
+ *        When the file reaches its maximum size, it gets rotated: `file` becomes `file.1`,
+ *        `file.1` becomes `file.2`, and so on, up to the configured number of files.
+ */
+class IS_CORE_API Tracer
+{
+public:
+
+    /**
+     * @brief Clock used to measure the spans.
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @struct Policy
+     * @brief Configures which messages are traced and where.
+     *
+     * @var Policy::file
+     *      @brief Path of the file where the spans are written.
+     *
+     * @var Policy::sample_rate
+     *      @brief Fraction of the messages that get traced, from 0 to 1.
+     *
+     * @var Policy::max_file_size
+     *      @brief Size, in bytes, from which the file gets rotated.
+     *
+     * @var Policy::max_files
+     *      @brief Number of rotated files kept besides the current one.
+     */
+    struct Policy
+    {
+        std::string file = "is-trace.json";
+        double sample_rate = 0.01;
+        std::size_t max_file_size = 64 * 1024 * 1024;
+        std::size_t max_files = 3;
+    };
+
+    /**
+     * @brief Constructor. Opens the file and launches the writer thread.
+     *
+     * @param[in] policy Configuration of the tracer.
+     */
+    Tracer(
+            const Policy& policy);
+
+    /**
+     * @brief Tracer shall not be copy constructible.
+     */
+    Tracer(
+            const Tracer& /*other*/) = delete;
+
+    /**
+     * @brief Destructor. Writes the pending spans and closes the file.
+     */
+    ~Tracer();
+
+    /**
+     * @brief Decides whether a new message gets traced.
+     *
+     * @returns The trace identifier for the message, or zero if it is not traced.
+     */
+    uint64_t sample();
+
+    /**
+     * @brief Records a span of a traced message.
+     *
+     * @param[in] trace The trace identifier of the message, as given by `sample()`.
+     *
+     * @param[in] name What the span measures, such as `receive` or `publish`.
+     *
+     * @param[in] route The key of the route.
+     *
+     * @param[in] system The system involved, if any.
+     *
+     * @param[in] start When the span started.
+     *
+     * @param[in] end When the span ended.
+     */
+    void record(
+            uint64_t trace,
+            const char* name,
+            const std::string& route,
+            const std::string& system,
+            Clock::time_point start,
+            Clock::time_point end);
+
+private:
+
+    /**
+     * @class Implementation
+     *        Defines the actual implementation of the Tracer class.
+     *
+     *        Allows to use the *pimpl* procedure to separate the implementation
+     *        from the interface of Tracer.
+     */
+    class Implementation;
+
+    /**
+     * Class members.
+     */
+
+    std::unique_ptr<Implementation> _pimpl;
+};
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_CORE_RUNTIME_TRACER_HPP_
@@ -0,0 +1,737 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_ASYNC_SYSTEMHANDLE_HPP_
+#define _IS_ASYNC_SYSTEMHANDLE_HPP_
+
+#if __cplusplus < 202002L || !__has_include(<coroutine>)
+#error "The asynchronous SystemHandle API requires C++20 coroutines."
+#endif //  __cplusplus < 202002L || !__has_include(<coroutine>)
+
+#include <is/systemhandle/SystemHandle.hpp>
+#include <is/utils/Log.hpp>
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace eprosima {
+namespace is {
+namespace async {
+
+/**
+ * @class Task
+ *        Return type of the coroutines of the asynchronous SystemHandle API.
+ *
+ *        Tasks are lazy: the coroutine does not start until the Task is awaited
+ *        with `co_await`, or handed over to `Scheduler::spawn()`. Then, the result
+ *        given to `co_return`, or the exception thrown, is passed to the awaiter.
+ *
+ * @tparam T The type of the result, which may be `void`.
+ */
+template<typename T = void>
+class Task;
+
+namespace detail {
+
+/**
+ * @brief Part of the promise of a Task which does not depend on its result type.
+ */
+class TaskPromiseBase
+{
+public:
+
+    /**
+     * @brief Resumes the awaiter of the Task, if any, once the coroutine finishes.
+     */
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<Promise> coroutine) noexcept
+        {
+            const std::coroutine_handle<> continuation = coroutine.promise()._continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    };
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        _exception = std::current_exception();
+    }
+
+    void set_continuation(
+            std::coroutine_handle<> continuation) noexcept
+    {
+        _continuation = continuation;
+    }
+
+    void rethrow_if_failed() const
+    {
+        if (_exception)
+        {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+private:
+
+    std::coroutine_handle<> _continuation;
+
+    std::exception_ptr _exception;
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+
+    Task<T> get_return_object() noexcept;
+
+    template<typename U>
+    void return_value(
+            U&& value)
+    {
+        _value.emplace(std::forward<U>(value));
+    }
+
+    T take_result()
+    {
+        rethrow_if_failed();
+        return std::move(*_value);
+    }
+
+private:
+
+    std::optional<T> _value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept
+    {
+    }
+
+    void take_result() const
+    {
+        rethrow_if_failed();
+    }
+
+};
+
+} //  namespace detail
+
+template<typename T>
+class Task
+{
+public:
+
+    using promise_type = detail::TaskPromise<T>;
+
+    /**
+     * @brief Constructor. Takes the ownership of the coroutine.
+     */
+    explicit Task(
+            std::coroutine_handle<promise_type> coroutine) noexcept
+        : _coroutine(coroutine)
+    {
+    }
+
+    /**
+     * @brief Task shall not be copy constructible.
+     */
+    Task(
+            const Task& /*other*/) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    Task(
+            Task&& other) noexcept
+        : _coroutine(std::exchange(other._coroutine, nullptr))
+    {
+    }
+
+    /**
+     * @brief Destructor. Destroys the coroutine, which must not be running.
+     */
+    ~Task()
+    {
+        if (_coroutine)
+        {
+            _coroutine.destroy();
+        }
+    }
+
+    /**
+     * @brief Starts the coroutine when awaited, and resumes the awaiter once it finishes.
+     */
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> coroutine;
+
+            bool await_ready() const noexcept
+            {
+                return !coroutine || coroutine.done();
+            }
+
+            std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<> awaiter) noexcept
+            {
+                coroutine.promise().set_continuation(awaiter);
+                return coroutine;
+            }
+
+            T await_resume()
+            {
+                return coroutine.promise().take_result();
+            }
+
+        };
+
+        return Awaiter{_coroutine};
+    }
+
+private:
+
+    std::coroutine_handle<promise_type> _coroutine;
+};
+
+namespace detail {
+
+template<typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T> >::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void> >::from_promise(*this));
+}
+
+/**
+ * @brief Coroutine type which owns itself, used to run the spawned Tasks to completion.
+ */
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+        }
+
+    };
+};
+
+} //  namespace detail
+
+/**
+ * @class Scheduler
+ *        Runs the coroutines of an asynchronous SystemHandle.
+ *
+ *        Coroutines are resumed by `run_once()`, which AsyncSystemHandle calls every time that
+ *        the *Integration Service* core spins the SystemHandle, so they run on the threads
+ *        configured in the `executor` section and no SystemHandle needs threads of its own.
+ *        Any thread can make a coroutine ready, through `schedule()` or a Completion.
+ *
+ *        The spawned coroutines should finish before the Scheduler gets destroyed;
+ *        the frames of those still waiting are not released.
+ */
+class Scheduler
+{
+public:
+
+    /**
+     * @brief Suspends the calling coroutine, to be resumed by the next `run_once()`.
+     *
+     * @returns An awaitable, to be used as `co_await scheduler.schedule();`.
+     */
+    auto schedule() noexcept
+    {
+        struct Awaiter
+        {
+            Scheduler& scheduler;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(
+                    std::coroutine_handle<> coroutine)
+            {
+                scheduler.post(coroutine);
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+
+        };
+
+        return Awaiter{*this};
+    }
+
+    /**
+     * @brief Runs a Task to completion in this Scheduler, discarding its result.
+     *        Its exceptions are logged.
+     *
+     * @param[in] task The Task to run. It starts in the next `run_once()`.
+     */
+    template<typename T>
+    void spawn(
+            Task<T> task)
+    {
+        run_detached(*this, std::move(task));
+    }
+
+    /**
+     * @brief Makes a suspended coroutine ready, to be resumed by the next `run_once()`.
+     *        Can be called from any thread.
+     */
+    void post(
+            std::coroutine_handle<> coroutine)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _ready.push_back(coroutine);
+    }
+
+    /**
+     * @brief Resumes the coroutines that were ready when called.
+     *
+     * @returns The number of coroutines resumed.
+     */
+    std::size_t run_once()
+    {
+        std::deque<std::coroutine_handle<> > ready;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            std::swap(ready, _ready);
+        }
+
+        for (std::coroutine_handle<> coroutine : ready)
+        {
+            coroutine.resume();
+        }
+
+        return ready.size();
+    }
+
+private:
+
+    template<typename T>
+    static detail::Detached run_detached(
+            Scheduler& scheduler,
+            Task<T> task)
+    {
+        co_await scheduler.schedule();
+
+        try
+        {
+            co_await std::move(task);
+        }
+        catch (const std::exception& e)
+        {
+            utils::Logger logger("is::async::Scheduler");
+            logger << utils::Logger::Level::ERROR
+                   << "A spawned coroutine failed: " << e.what() << std::endl;
+        }
+    }
+
+    /**
+     * Class members.
+     */
+
+    std::mutex _mutex;
+
+    std::deque<std::coroutine_handle<> > _ready;
+};
+
+/**
+ * @class Completion
+ *        One-shot result that a middleware callback, running in any thread, hands over
+ *        to a coroutine waiting for it in a Scheduler.
+ *
+ *        It is meant to wrap the callback based APIs of the middlewares: the coroutine
+ *        creates the Completion, passes a copy to the callback and awaits it, while the
+ *        callback calls `complete()`. Copies share the same state.
+ *
+ * @tparam T The type of the result.
+ */
+template<typename T>
+class Completion
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] scheduler The Scheduler where the waiting coroutine gets resumed.
+     */
+    explicit Completion(
+            Scheduler& scheduler)
+        : _state(std::make_shared<State>(scheduler))
+    {
+    }
+
+    /**
+     * @brief Sets the result, and makes the waiting coroutine ready.
+     *        Only the first call has effect.
+     */
+    void complete(
+            T value)
+    {
+        std::coroutine_handle<> waiting;
+        {
+            std::unique_lock<std::mutex> lock(_state->mutex);
+            if (_state->value)
+            {
+                return;
+            }
+
+            _state->value.emplace(std::move(value));
+            waiting = std::exchange(_state->waiting, nullptr);
+        }
+
+        if (waiting)
+        {
+            _state->scheduler.post(waiting);
+        }
+    }
+
+    /**
+     * @brief Waits for the result, without blocking the thread.
+     */
+    auto operator co_await() const noexcept
+    {
+        struct Awaiter
+        {
+            std::shared_ptr<State> state;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            bool await_suspend(
+                    std::coroutine_handle<> coroutine)
+            {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                if (state->value)
+                {
+                    return false;
+                }
+
+                state->waiting = coroutine;
+                return true;
+            }
+
+            T await_resume()
+            {
+                return std::move(*state->value);
+            }
+
+        };
+
+        return Awaiter{_state};
+    }
+
+private:
+
+    struct State
+    {
+        explicit State(
+                Scheduler& scheduler_)
+            : scheduler(scheduler_)
+        {
+        }
+
+        Scheduler& scheduler;
+        std::mutex mutex;
+        std::optional<T> value;
+        std::coroutine_handle<> waiting;
+    };
+
+    std::shared_ptr<State> _state;
+};
+
+/**
+ * @class AsyncSystemHandle
+ *        SystemHandle whose work is done by coroutines, run by its own Scheduler.
+ *
+ *        Each time the *Integration Service* core spins it, the coroutines that became
+ *        ready get resumed, and the spin is reported as idle if there were none, so that
+ *        the configured `spin` policy applies. The `run()` coroutine is spawned on the first spin.
+ */
+class AsyncSystemHandle : public virtual SystemHandle
+{
+public:
+
+    /**
+     * @brief Gets the Scheduler of this SystemHandle, to be shared with its publishers and providers.
+     */
+    Scheduler& scheduler()
+    {
+        return _scheduler;
+    }
+
+    /**
+     * @brief Long running work of the SystemHandle, such as reading from the middleware.
+     *        By default, there is none.
+     */
+    virtual Task<void> run()
+    {
+        co_return;
+    }
+
+    SpinResult spin_and_report() override
+    {
+        if (!_started)
+        {
+            _started = true;
+            _scheduler.spawn(run());
+        }
+
+        if (!okay())
+        {
+            return SpinResult::FAILURE;
+        }
+
+        return _scheduler.run_once() > 0 ? SpinResult::WORK_DONE : SpinResult::IDLE;
+    }
+
+    bool spin_once() override
+    {
+        return spin_and_report() != SpinResult::FAILURE;
+    }
+
+private:
+
+    Scheduler _scheduler;
+
+    bool _started = false;
+};
+
+/**
+ * @class AsyncTopicPublisher
+ *        TopicPublisher implemented by a coroutine.
+ *
+ *        Each message given to `publish()` is copied, and published by `publish_async()`
+ *        in the Scheduler, so `publish()` never blocks the thread of the source system.
+ */
+class AsyncTopicPublisher : public TopicPublisher
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] scheduler The Scheduler where the messages get published. It must outlive this object.
+     */
+    explicit AsyncTopicPublisher(
+            Scheduler& scheduler)
+        : _scheduler(scheduler)
+    {
+    }
+
+    /**
+     * @brief Publishes a message to the middleware.
+     *
+     * @param[in] message The message to publish, owned by the coroutine.
+     *
+     * @returns `true` if the message was published, `false` otherwise.
+     */
+    virtual Task<bool> publish_async(
+            xtypes::DynamicData message) = 0;
+
+    bool publish(
+            const xtypes::DynamicData& message) override
+    {
+        _scheduler.spawn(publish_async(message));
+        return true;
+    }
+
+private:
+
+    Scheduler& _scheduler;
+};
+
+/**
+ * @class AsyncServiceProvider
+ *        ServiceProvider implemented by a coroutine, which simply returns the reply.
+ *
+ *        The reply returned by `call_service_async()` is passed to
+ *        `ServiceClient::receive_response()` by this class, so implementations do not
+ *        need to keep track of the clients and call handles of the pending requests.
+ */
+class AsyncServiceProvider : public ServiceProvider
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] scheduler The Scheduler where the requests get served. It must outlive this object.
+     */
+    explicit AsyncServiceProvider(
+            Scheduler& scheduler)
+        : _scheduler(scheduler)
+    {
+    }
+
+    /**
+     * @brief Serves a request.
+     *
+     * @param[in] request The request message, owned by the coroutine.
+     *
+     * @returns The reply message.
+     */
+    virtual Task<xtypes::DynamicData> call_service_async(
+            xtypes::DynamicData request) = 0;
+
+    void call_service(
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle) override
+    {
+        _scheduler.spawn(respond(call_service_async(request), client, std::move(call_handle)));
+    }
+
+private:
+
+    static Task<void> respond(
+            Task<xtypes::DynamicData> call,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle)
+    {
+        const xtypes::DynamicData reply = co_await std::move(call);
+        client.receive_response(call_handle, reply);
+    }
+
+    Scheduler& _scheduler;
+};
+
+/**
+ * @class AsyncServiceClient
+ *        ServiceClient which lets a coroutine await the reply of a ServiceProvider.
+ *
+ *        `call()` passes the request to the provider, and the coroutine is resumed in the
+ *        Scheduler once the provider calls `receive_response()`, from any thread.
+ *        The client must outlive its pending calls, and a call whose reply never comes
+ *        keeps waiting, so providers with a timeout should answer when it expires.
+ */
+class AsyncServiceClient : public ServiceClient
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] scheduler The Scheduler where the callers get resumed. It must outlive this object.
+     */
+    explicit AsyncServiceClient(
+            Scheduler& scheduler)
+        : _scheduler(scheduler)
+    {
+    }
+
+    /**
+     * @brief Calls a service, and waits for its reply without blocking the thread.
+     *
+     * @param[in] provider The ServiceProvider which serves the request.
+     *
+     * @param[in] request The request message, owned by the coroutine.
+     *
+     * @returns The reply message.
+     */
+    Task<xtypes::DynamicData> call(
+            ServiceProvider& provider,
+            xtypes::DynamicData request)
+    {
+        Completion<xtypes::DynamicData> reply(_scheduler);
+        provider.call_service(request, *this, std::make_shared<Completion<xtypes::DynamicData> >(reply));
+        co_return co_await reply;
+    }
+
+    void receive_response(
+            std::shared_ptr<void> call_handle,
+            const xtypes::DynamicData& response) override
+    {
+        static_cast<Completion<xtypes::DynamicData>*>(call_handle.get())->complete(response);
+    }
+
+private:
+
+    Scheduler& _scheduler;
+};
+
+} //  namespace async
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_ASYNC_SYSTEMHANDLE_HPP_
@@ -35,12 +35,13 @@ namespace internal {
  *        SystemHandle instance.
  *
  *        This class will retrieve the corresponding TopicPublisherSystem,
- *        TopicSubscriberSystem, ServiceClientSystem and ServiceProviderSystem
- *        instances associated to the SystemHandle instance, if applicable.
+ *        TopicSubscriberSystem, ServiceClientSystem, ServiceProviderSystem
+ *        and EventDrivenSystem instances associated to the SystemHandle instance,
+ *        if applicable.
  *
  *        If not applicable, these instances will just be cast to `nullptr`.
  *        Later on, this will allow to know whether a certain SystemHandle comes
- *        or not with any of these four working capabilities.
+ *        or not with any of these working capabilities.
  *
  *        Also, a is::TypeRegistry is defined, where all the types that the SystemHandle
  *        instance must know prior to start performing any conversion are defined.
@@ -96,7 +97,15 @@ public:
 
     ServiceProviderSystem* service_provider;
 
+    EventDrivenSystem* event_driven;
+
     TypeRegistry types;
+
+    /**
+     * Held while the SystemHandle spins, and while its topics and services are changed
+     * once it is running, so that it is never asked to change them in the middle of a spin.
+     */
+    mutable std::mutex spin_mutex;
 };
 
 //==============================================================================
@@ -94,6 +94,14 @@ using TypeRegistry = std::map<std::string, xtypes::DynamicType::Ptr>;
  *        A SystemHandle implementing the four interfaces described above is
  *        called a FullSystem, and it is usually the base class used for implementing
  *        a middleware plugin for the *Integration Service*.
+ *
+ *        SystemHandles are not required to be thread-safe. In particular, the methods that set up
+ *        or remove topics and services, such as `subscribe`, `unsubscribe`, `advertise`,
+ *        `create_client_proxy`, `remove_client_proxy` and `create_service_proxy`, are never called
+ *        while `spin_and_report()` runs, not even when they are called from another thread
+ *        while running, to reload the configuration or to switch an `on_demand` topic:
+ *        the core waits for the ongoing spin to finish, and holds the next one until they return.
+ *        They may still run while other systems publish through the publishers of this one.
  */
 class SystemHandle
 {
@@ -179,6 +187,33 @@ public:
      */
     virtual bool spin_once() = 0;
 
+    /**
+     * @brief Outcome of a `spin_and_report()` call.
+     */
+    enum class SpinResult
+    {
+        FAILURE,    //  The SystemHandle is not working anymore.
+        IDLE,       //  There was nothing to do.
+        WORK_DONE   //  Some work was done, so there may be more pending.
+    };
+
+    /**
+     * @brief Tell the SystemHandle to spin once, reporting whether it had something to do.
+     *
+     *        This is the method actually called by the *Integration Service* core, which uses
+     *        the result to apply the `spin` policy configured for the system when it is idle.
+     *        SystemHandles that override it should not sleep when they have nothing to do,
+     *        and leave that decision to the configured policy instead.
+     *
+     *        The default implementation calls `spin_once()` and always reports `WORK_DONE`.
+     *
+     * @returns The SpinResult of this iteration.
+     */
+    virtual SpinResult spin_and_report()
+    {
+        return spin_once() ? SpinResult::WORK_DONE : SpinResult::FAILURE;
+    }
+
     /**
      * @brief Perform additional actions prior to configure the System Handle regarding types.
      *
@@ -194,6 +229,47 @@ public:
     }
 };
 
+/**
+ * @class EventDrivenSystem
+ *        Extends the SystemHandle class with a waitable handle, which tells
+ *        the *Integration Service* core when there is work to do.
+ *
+ *        SystemHandles implementing this interface are not given a thread that
+ *        loops over `spin_and_report()`. Instead, all of them are run by a single reactor
+ *        thread, which only calls `spin_and_report()` when their wait handle is readable.
+ *        A system listed in an executor thread is polled by that thread instead, which
+ *        only uses the wait handle to sleep while idle with the `blocking` spin policy.
+ *        The reactor is only supported on Linux; on other platforms, these SystemHandles
+ *        are spun as usual.
+ */
+class EventDrivenSystem : public virtual SystemHandle
+{
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    EventDrivenSystem() = default;
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventDrivenSystem() = default;
+
+    /**
+     * @brief Gets the file descriptor that signals that `spin_and_report()` has work to do.
+     *
+     * @attention The descriptor is watched in level-triggered mode: it must stay readable
+     *            while there is pending work, and stop being so once `spin_and_report()` has
+     *            processed it (for example, by reading from an `eventfd`). It must remain
+     *            open for as long as the SystemHandle exists.
+     *
+     * @returns The file descriptor, or a negative value if this SystemHandle instance
+     *          cannot provide one, in which case it will be spun as usual.
+     */
+    virtual int wait_handle() const = 0;
+};
+
 /**
  * @class TopicSubscriberSystem
  *        Extends the SystemHandle class with subscription capabilities.
@@ -237,6 +313,39 @@ public:
             SubscriptionCallback* callback,
             const YAML::Node& configuration) = 0;
 
+    /**
+     * @brief Removes the subscription to a topic, when the topic disappears from the
+     *        configuration while reloading it.
+     *
+     *        The callback given to `subscribe` is kept alive by the core, and it stops
+     *        forwarding messages regardless of the result of this call, so implementing it
+     *        only spares the middleware from delivering messages that will be discarded.
+     *
+     *        Once it returns `true`, the callback given to `subscribe` must not be called anymore.
+     *
+     * @param[in] topic_name Name of the topic to get unsubscribed from.
+     *
+     * @returns `true` if the subscription was removed, `false` if it is not supported.
+     */
+    virtual bool unsubscribe(
+            const std::string& /*topic_name*/)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Tells whether this system implements `unsubscribe`.
+     *
+     *        A topic whose route changes while reloading is only replaced if all its source systems
+     *        can unsubscribe from it. Otherwise, they would keep a duplicate subscription.
+     *
+     * @returns `true` if `unsubscribe` is supported, `false` otherwise.
+     */
+    virtual bool can_unsubscribe() const
+    {
+        return false;
+    }
+
     /**
      * @brief Check if a certain message in a subscriber comes from a middleware publisher
      *        created by *Integration Service* in the same SystemHandle instance.
@@ -291,6 +400,32 @@ public:
     virtual bool publish(
             const xtypes::DynamicData& message) = 0;
 
+    /**
+     * @brief Signature of the callback that reports how many subscribers are matched
+     *        with a publisher.
+     */
+    using MatchedCallback = std::function<void (std::size_t matched_subscribers)>;
+
+    /**
+     * @brief Sets the callback that must be notified whenever the number of subscribers
+     *        matched with this publisher changes.
+     *
+     *        It is used by the topics configured with `on_demand`, which only receive
+     *        data from their sources while some destination has subscribers.
+     *        Once set, the callback should be called right away with the current count,
+     *        and then each time it changes. It may be called from any thread.
+     *
+     * @param[in] callback The callback to notify.
+     *
+     * @returns `true` if the publisher reports its matched subscribers, `false` if not
+     *          supported, in which case it is considered to always have subscribers.
+     */
+    virtual bool set_matched_callback(
+            MatchedCallback /*callback*/)
+    {
+        return false;
+    }
+
 };
 
 /**
@@ -399,6 +534,9 @@ public:
      *            service response message.
      *
      * @param[in] response The message that represents the response from the service.
+     *            If the reply type of the server is compatible with, but not equal to,
+     *            the reply type of this client, the core will have already converted it
+     *            into the latter, so no further conversion is required.
      */
     virtual void receive_response(
             std::shared_ptr<void> call_handle,
@@ -487,6 +625,37 @@ public:
         return create_client_proxy(service_name, request_type, callback, configuration);
     }
 
+    /**
+     * @brief Removes the client proxy of a service, when the service disappears from the
+     *        configuration, or changes, while reloading it.
+     *
+     *        The client applications should see the service disappear, instead of getting their
+     *        requests ignored. Once it returns `true`, the callback given to `create_client_proxy`
+     *        must not be called anymore.
+     *
+     * @param[in] service_name Name of the service whose client proxy must be removed.
+     *
+     * @returns `true` if the client proxy was removed, `false` if it is not supported.
+     */
+    virtual bool remove_client_proxy(
+            const std::string& /*service_name*/)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Tells whether this system implements `remove_client_proxy`.
+     *
+     *        A service can only be removed or replaced while reloading if all its client systems
+     *        can remove their proxies.
+     *
+     * @returns `true` if `remove_client_proxy` is supported, `false` otherwise.
+     */
+    virtual bool can_remove_client_proxy() const
+    {
+        return false;
+    }
+
 };
 
 /**
@@ -523,6 +692,7 @@ public:
 
     // TODO (@jamoralp): can we come up with a way to avoid calling receive_response
     // from the call_service method? This would make the systemhandle implementation more intuitive and easier.
+    // SystemHandles built with C++20 can use AsyncServiceProvider, from AsyncSystemHandle.hpp, which does it.
 
     /**
      * @brief Call a service.
@@ -546,6 +716,50 @@ public:
             const xtypes::DynamicData& request,
             ServiceClient& client,
             std::shared_ptr<void> call_handle) = 0;
+
+    /**
+     * @struct Request
+     * @brief A single request of a batch, along with the information needed to answer it.
+     *
+     * @var Request::request
+     *      @brief Request message for the service.
+     *
+     * @var Request::client
+     *      @brief The proxy for the client that made the request.
+     *
+     * @var Request::call_handle
+     *      @brief The handle for the call, to be passed back to the client.
+     */
+    struct Request
+    {
+        xtypes::DynamicData request;
+        ServiceClient* client;
+        std::shared_ptr<void> call_handle;
+    };
+
+    /**
+     * @brief Call a service with several requests at once.
+     *
+     *        The *Integration Service* core uses it for services that have a `batching`
+     *        policy configured, with the requests received within the batching window.
+     *        Middlewares able to answer several requests in a single round trip should
+     *        override it; the default implementation calls `call_service` for each request.
+     *
+     * @attention The same requirements as `call_service` apply: this function must be
+     *            **non-blocking** and `receive_response()` must be called on the client
+     *            of **each** request, with its own call handle, when it finishes.
+     *
+     * @param[in] requests The batch of requests, in arrival order.
+     */
+    virtual void call_service_batch(
+            const std::vector<Request>& requests)
+    {
+        for (const Request& request : requests)
+        {
+            call_service(request.request, *request.client, request.call_handle);
+        }
+    }
+
 };
 
 /**
@@ -31,6 +31,13 @@ namespace utils {
  *        Allows to easily log information into the standard output.
  *        It should be used as the preferred method for printing information
  *        within the whole Integration Service suite (core and SystemHandle).
+ *
+ *        Each message is composed in a buffer of the calling thread, so that a Logger can be
+ *        shared by several threads, and it is handed over to a background thread through
+ *        a lock-free queue once `std::endl` is received. The background thread writes it to
+ *        the standard output, so that a slow output never blocks the threads that log.
+ *        If a thread logs faster than the output can take, its latest messages are dropped
+ *        and a warning reports how many were lost.
  */
 class IS_CORE_API Logger
 {
@@ -62,7 +69,8 @@ public:
     /**
      * @class CurrentLevelStatus
      *        Enumeration class which stores all the possible statuses
-     *        for the current operation in the logger.
+     *        for the current operation in the logger. The status is kept
+     *        for each thread that is composing a message.
      *
      *        * **Values**:
      *
@@ -159,25 +167,9 @@ public:
     Logger& operator <<(
             const T& value)
     {
-        switch (_status)
+        if (std::ostream* message = current_message())
         {
-            case CurrentLevelStatus::NON_SPECIFIED:
-            {
-                // By default, INFO level will be used if the user has not specified it.
-                operator <<(Level::INFO);
-                return operator <<(value);
-                break;
-            }
-            case CurrentLevelStatus::SPECIFIED:
-            {
-                std::cout << value;
-                break;
-            }
-            case CurrentLevelStatus::SPECIFIED_BUT_HIDDEN:
-            {
-                // Do nothing
-                break;
-            }
+            *message << value;
         }
 
         return *this;
@@ -196,8 +188,22 @@ public:
             (*func)(
                 std::basic_ostream<char, std::char_traits<char> >&));
 
+    /**
+     * @brief Writes right away the messages completed so far by every thread, instead of
+     *        waiting for the background thread. It is called automatically when the process exits.
+     */
+    static void flush();
+
 private:
 
+    /**
+     * @brief Gets the message that the calling thread is composing with this Logger,
+     *        starting one with the `INFO` level if there is none.
+     *
+     * @returns The buffer of the message, or `nullptr` if its level is hidden.
+     */
+    std::ostream* current_message();
+
     /**
      * Operations for setting on/off ostream bold characters and colors.
      */
@@ -223,7 +229,6 @@ private:
 
     const std::string _header;
     Level _max_level;
-    CurrentLevelStatus _status;
 };
 
 } //  namespace utils
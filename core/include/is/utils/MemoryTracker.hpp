@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef _IS_UTILS_MEMORYTRACKER_HPP_
+#define _IS_UTILS_MEMORYTRACKER_HPP_
+
+#include <is/core/export.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace eprosima {
+namespace is {
+namespace utils {
+
+/**
+ * @class MemoryTracker
+ *        Attributes the memory allocated within the process to accounts, such as the routes
+ *        or the type registries of the systems, so that the growth of an instance can be traced
+ *        back to its origin.
+ *
+ *        Every allocation is charged to the account set on its thread by the innermost Scope,
+ *        or to the `other` account if there is none, and it is released from that same account
+ *        when freed. This way, messages waiting in a queue keep counting for the route that
+ *        received them until they are forwarded.
+ *
+ *        The allocations are only tracked if the core library was built with the
+ *        `IS_PROFILE_ALLOCATIONS` CMake option, which replaces the global `operator new`
+ *        with one that keeps a small header before each block. Otherwise, the accounts stay empty.
+ *        With the option, every plugin must use the allocation functions of the core library.
+ */
+class IS_CORE_API MemoryTracker
+{
+public:
+
+    /**
+     * @struct Usage
+     * @brief Memory charged to an account.
+     *
+     * @var Usage::allocations
+     *      @brief Number of allocations made so far.
+     *
+     * @var Usage::allocated_bytes
+     *      @brief Memory allocated so far, including the memory already freed.
+     *
+     * @var Usage::live_bytes
+     *      @brief Memory allocated and not freed yet.
+     */
+    struct Usage
+    {
+        uint64_t allocations = 0;
+        uint64_t allocated_bytes = 0;
+        uint64_t live_bytes = 0;
+    };
+
+    /**
+     * @struct ThreadCounters
+     * @brief Allocations made by the current thread, whatever their account.
+     *
+     * @var ThreadCounters::allocations
+     *      @brief Number of allocations made so far.
+     *
+     * @var ThreadCounters::bytes
+     *      @brief Memory allocated so far.
+     */
+    struct ThreadCounters
+    {
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @brief Opaque handle to an account. Accounts are never destroyed, so handles stay valid.
+     */
+    class Account;
+
+    /**
+     * @class Scope
+     *        Charges the allocations of the current thread to an account while it is alive.
+     */
+    class IS_CORE_API Scope
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] account The account to charge, as given by `MemoryTracker::account()`.
+         */
+        explicit Scope(
+                Account* account);
+
+        /**
+         * @brief Scope shall not be copy constructible.
+         */
+        Scope(
+                const Scope& /*other*/) = delete;
+
+        /**
+         * @brief Destructor. Goes back to charging the previous account.
+         */
+        ~Scope();
+
+    private:
+
+        Account* const _previous;
+    };
+
+    /**
+     * @brief Checks whether the allocations are being tracked.
+     */
+    static bool enabled();
+
+    /**
+     * @brief Gets an account, creating it the first time. Looking it up takes a lock, so the
+     *        hot paths should keep the handle instead of calling this for every Scope.
+     *
+     * @param[in] name Name of the account, such as `topic:<name>` or `system:<name>`.
+     */
+    static Account* account(
+            const std::string& name);
+
+    /**
+     * @brief Gets the memory charged to every account.
+     *
+     * @returns The usage of each account, by name.
+     */
+    static std::map<std::string, Usage> usage();
+
+    /**
+     * @brief Gets the allocations made by the current thread.
+     */
+    static ThreadCounters thread_counters();
+};
+
+} //  namespace utils
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_UTILS_MEMORYTRACKER_HPP_
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef _IS_UTILS_PROFILER_HPP_
+#define _IS_UTILS_PROFILER_HPP_
+
+#include <is/core/export.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace utils {
+
+/**
+ * @class Profiler
+ *        Measures the time, and the memory allocations, spent converting data within
+ *        the *Integration Service* suite: between each pair of types, between xTypes and JSON,
+ *        and while filling string templates.
+ *
+ *        It is disabled by default. While disabled, a Scope only checks a flag. Once enabled,
+ *        every thread accumulates its figures on its own table, so that the threads being
+ *        measured do not contend with each other. The tables are only merged when a report is requested.
+ *
+ *        The allocations are only counted if the core library was built with the
+ *        `IS_PROFILE_ALLOCATIONS` CMake option, which replaces the global `operator new`.
+ */
+class IS_CORE_API Profiler
+{
+public:
+
+    /**
+     * @struct Entry
+     * @brief Accumulated figures of a profiled operation.
+     *
+     * @var Entry::section
+     *      @brief What was profiled, such as `conversion` or `json_xtypes::convert`.
+     *
+     * @var Entry::key
+     *      @brief The data it was profiled for, such as the pair of types being converted.
+     *
+     * @var Entry::calls
+     *      @brief Number of times the operation was done.
+     *
+     * @var Entry::nanoseconds
+     *      @brief Total time spent in the operation.
+     *
+     * @var Entry::max_nanoseconds
+     *      @brief Time spent in the slowest call.
+     *
+     * @var Entry::allocations
+     *      @brief Number of memory allocations made by the operation.
+     *
+     * @var Entry::allocated_bytes
+     *      @brief Memory allocated by the operation.
+     */
+    struct Entry
+    {
+        std::string section;
+        std::string key;
+        uint64_t calls = 0;
+        uint64_t nanoseconds = 0;
+        uint64_t max_nanoseconds = 0;
+        uint64_t allocations = 0;
+        uint64_t allocated_bytes = 0;
+    };
+
+    /**
+     * @class Scope
+     *        Profiles the operation done while it is alive, if the Profiler is enabled.
+     *
+     *        The strings given to the constructor are only read on destruction, so they must
+     *        outlive the Scope. They are only joined into the key when the Profiler is enabled.
+     */
+    class IS_CORE_API Scope
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] section What is being profiled.
+         *
+         * @param[in] key The data it is being profiled for.
+         */
+        Scope(
+                const char* section,
+                const std::string& key)
+            : Scope(section, key, nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructor for operations between two types.
+         *
+         * @param[in] section What is being profiled.
+         *
+         * @param[in] from The source type.
+         *
+         * @param[in] to The destination type.
+         */
+        Scope(
+                const char* section,
+                const std::string& from,
+                const std::string& to)
+            : Scope(section, from, &to)
+        {
+        }
+
+        /**
+         * @brief Scope shall not be copy constructible.
+         */
+        Scope(
+                const Scope& /*other*/) = delete;
+
+        /**
+         * @brief Destructor. Accounts for the operation.
+         */
+        ~Scope()
+        {
+            if (_section)
+            {
+                finish();
+            }
+        }
+
+    private:
+
+        Scope(
+                const char* section,
+                const std::string& from,
+                const std::string* to)
+            : _section(Profiler::enabled() ? section : nullptr)
+            , _from(from)
+            , _to(to)
+        {
+            if (_section)
+            {
+                start();
+            }
+        }
+
+        void start();
+
+        void finish();
+
+        const char* const _section;
+        const std::string& _from;
+        const std::string* const _to;
+        std::chrono::steady_clock::time_point _start;
+        uint64_t _allocations = 0;
+        uint64_t _allocated_bytes = 0;
+    };
+
+    /**
+     * @brief Enables or disables the Profiler. The figures gathered so far are kept.
+     */
+    static void enable(
+            bool enabled = true);
+
+    /**
+     * @brief Checks whether the Profiler is enabled.
+     */
+    static bool enabled()
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether the allocations are being counted.
+     */
+    static bool counts_allocations();
+
+    /**
+     * @brief Gathers the figures of every thread.
+     *
+     * @returns The profiled operations, ranked from the one that took the most time overall.
+     */
+    static std::vector<Entry> report();
+
+    /**
+     * @brief Writes the report as a table.
+     *
+     * @param[in] max_entries Maximum number of operations in the table, zero meaning all of them.
+     *
+     * @returns The table, one operation per line, preceded by a header.
+     */
+    static std::string dump(
+            std::size_t max_entries = 0);
+
+    /**
+     * @brief Discards the figures gathered so far.
+     */
+    static void reset();
+
+private:
+
+    static std::atomic_bool _enabled;
+};
+
+} //  namespace utils
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_UTILS_PROFILER_HPP_
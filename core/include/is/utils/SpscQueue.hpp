@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _IS_UTILS_SPSCQUEUE_HPP_
+#define _IS_UTILS_SPSCQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace eprosima {
+namespace is {
+namespace utils {
+
+//==============================================================================
+/**
+ * @class SpscQueue
+ *        Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ *        The producer only writes the tail and the consumer only writes the head,
+ *        so neither side ever waits for the other. Both indexes live in their own
+ *        cache line to avoid false sharing between the two threads.
+ *
+ * @tparam T Type of the elements. It must be default constructible and move assignable.
+ */
+template<typename T>
+class SpscQueue
+{
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] capacity Minimum number of elements that the queue can hold.
+     *            It is rounded up to the next power of two.
+     */
+    explicit SpscQueue(
+            std::size_t capacity)
+        : _mask(round_up(capacity) - 1)
+        , _slots(new T[_mask + 1])
+        , _head(0)
+        , _tail(0)
+    {
+    }
+
+    /**
+     * @brief SpscQueue shall not be copy constructible.
+     */
+    SpscQueue(
+            const SpscQueue& /*other*/) = delete;
+
+    /**
+     * @brief Appends an element. Must only be called from the producer thread.
+     *
+     * @param[in] value The element, which is moved into the queue on success.
+     *
+     * @returns `false` if the queue is full, `true` otherwise.
+     */
+    bool try_push(
+            T&& value)
+    {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) > _mask)
+        {
+            return false;
+        }
+
+        _slots[tail & _mask] = std::move(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element. Must only be called from the consumer thread.
+     *
+     * @param[out] value Where the element is moved on success.
+     *
+     * @returns `false` if the queue is empty, `true` otherwise.
+     */
+    bool try_pop(
+            T& value)
+    {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        value = std::move(_slots[head & _mask]);
+        _slots[head & _mask] = T();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the queue is empty. Exact only when called from the consumer thread.
+     */
+    bool empty() const
+    {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the number of elements in the queue. It can be called from any thread,
+     *        but it is only a hint when the queue is in use.
+     */
+    std::size_t size() const
+    {
+        const std::size_t head = _head.load(std::memory_order_acquire);
+        const std::size_t tail = _tail.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Gets the number of elements that the queue can hold.
+     */
+    std::size_t capacity() const
+    {
+        return _mask + 1;
+    }
+
+private:
+
+    static std::size_t round_up(
+            std::size_t capacity)
+    {
+        std::size_t rounded = 1;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+
+    /**
+     * Size of the cache lines, assumed to be the usual one since
+     * `std::hardware_destructive_interference_size` is not widely available.
+     */
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    /**
+     * Class members.
+     */
+
+    const std::size_t _mask;
+
+    std::unique_ptr<T[]> _slots;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> _head;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> _tail;
+};
+
+} //  namespace utils
+} //  namespace is
+} //  namespace eprosima
+
+#endif //  _IS_UTILS_SPSCQUEUE_HPP_
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#ifndef _IS_UTILS_TRACEPOINT_HPP_
+#define _IS_UTILS_TRACEPOINT_HPP_
+
+/**
+ * Static tracepoints (USDT) for tools such as `perf`, `bpftrace` or SystemTap.
+ *
+ * `IS_TRACEPOINT(name, args...)` marks a point of the code with a probe named `name`,
+ * under the `integration_service` provider, which passes up to twelve integer or pointer
+ * arguments to the attached tools. Strings are passed as `const char*`.
+ *
+ * The tracepoints are only compiled in when `IS_TRACEPOINTS` is defined, which the core library
+ * does if built with the `IS_TRACEPOINTS` CMake option on a system providing `<sys/sdt.h>`.
+ * Each tracepoint is then a single `nop` instruction until a tool attaches to it.
+ * Otherwise, they expand to nothing, and their arguments are not evaluated.
+ *
+ * For example, the time spent publishing to each system can be watched with:
+ *
+ * ```
+ * bpftrace -e 'usdt:/path/to/libis-core.so:integration_service:publish
+ *              { @[str(arg0), str(arg1)] = hist(arg2); }'
+ * ```
+ */
+
+#if defined(IS_TRACEPOINTS) && defined(__linux__)
+
+#include <sys/sdt.h>
+
+#define IS_TRACEPOINT(...) STAP_PROBEV(integration_service, __VA_ARGS__)
+
+#else
+
+#define IS_TRACEPOINT(...) do {} while (false)
+
+#endif //  defined(IS_TRACEPOINTS) && defined(__linux__)
+
+#endif //  _IS_UTILS_TRACEPOINT_HPP_
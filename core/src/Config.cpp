@@ -17,10 +17,18 @@
  */
 
 #include <is/core/Config.hpp>
+#include <is/core/runtime/ServiceCallTracker.hpp>
+#include <is/core/runtime/ServiceReplyConversion.hpp>
+#include <is/core/runtime/TopicDemand.hpp>
+#include <is/utils/MemoryTracker.hpp>
+#include <is/utils/Profiler.hpp>
+#include <is/utils/Tracepoint.hpp>
 #include <is/systemhandle/SystemHandle.hpp>
 
 #include <algorithm>
+#include <future>
 #include <iostream>
+#include <mutex>
 
 namespace eprosima {
 namespace is {
@@ -559,6 +567,76 @@ bool add_topic_or_service_config(
     return valid;
 }
 
+//==============================================================================
+/**
+ * @brief Reads an optional scalar field, reporting it if it does not hold the expected type.
+ *
+ * @param[in] node The node which may contain the field.
+ *
+ * @param[in] field The name of the field.
+ *
+ * @param[in] owner What the field belongs to, such as "the executor", for the error message.
+ *
+ * @param[in] expected The expected type, such as "a boolean", for the error message.
+ *
+ * @param[out] value Where the field is read. It is left untouched if the field is missing.
+ *
+ * @returns `false` if the field is present but invalid, `true` otherwise.
+ */
+template<typename T>
+bool parse_optional_field(
+        const YAML::Node& node,
+        const std::string& field,
+        const std::string& owner,
+        const char* expected,
+        T& value)
+{
+    if (!node[field])
+    {
+        return true;
+    }
+
+    try
+    {
+        value = node[field].as<T>();
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The '" << field << "' field of " << owner << " must be " << expected
+                       << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Reads an optional duration, given as an integer count of its unit.
+ */
+template<typename Rep, typename Period>
+bool parse_optional_field(
+        const YAML::Node& node,
+        const std::string& field,
+        const std::string& owner,
+        const char* expected,
+        std::chrono::duration<Rep, Period>& value)
+{
+    if (!node[field])
+    {
+        return true;
+    }
+
+    uint32_t count = 0;
+    if (!parse_optional_field(node, field, owner, expected, count))
+    {
+        return false;
+    }
+
+    value = std::chrono::duration<Rep, Period>(count);
+    return true;
+}
+
 //==============================================================================
 bool add_topic_config(
         const std::string& name,
@@ -566,7 +644,7 @@ bool add_topic_config(
         const std::map<std::string, TopicRoute>& topic_routes,
         std::map<std::string, TopicConfig>& topic_configs)
 {
-    return add_topic_or_service_config<TopicConfig, TopicRoute>(
+    const bool valid = add_topic_or_service_config<TopicConfig, TopicRoute>(
         "topic", name, node, topic_routes, topic_configs,
         [=](TopicConfig& config, std::string&& type)
         {
@@ -603,6 +681,147 @@ bool add_topic_config(
         {
             return parse_topic_route(route);
         });
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    return parse_optional_field(node, "on_demand", "the topic '" + name + "'", "a boolean",
+                   topic_configs.at(name).on_demand);
+}
+
+//==============================================================================
+bool parse_hedging_policy(
+        const std::string& service_name,
+        const YAML::Node& node,
+        std::optional<ServiceHedging::Policy>& hedging)
+{
+    ServiceHedging::Policy policy;
+
+    try
+    {
+        if (node.IsScalar())
+        {
+            if (!node.as<bool>())
+            {
+                return true;
+            }
+        }
+        else if (node.IsMap())
+        {
+            if (node["percentile"])
+            {
+                policy.percentile = node["percentile"].as<double>();
+            }
+            if (node["initial_delay_ms"])
+            {
+                policy.initial_delay = std::chrono::milliseconds(node["initial_delay_ms"].as<uint32_t>());
+            }
+            if (node["min_delay_ms"])
+            {
+                policy.min_delay = std::chrono::milliseconds(node["min_delay_ms"].as<uint32_t>());
+            }
+            if (node["window"])
+            {
+                policy.window = node["window"].as<std::size_t>();
+            }
+            if (node["min_samples"])
+            {
+                policy.min_samples = node["min_samples"].as<std::size_t>();
+            }
+        }
+        else
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The 'hedging' field of the service '" << service_name
+                           << "' must be either a boolean or a dictionary!" << std::endl;
+            return false;
+        }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'hedging' configuration for the service '" << service_name
+                       << "': " << e.what() << std::endl;
+        return false;
+    }
+
+    if (!(policy.percentile > 0.0 && policy.percentile <= 100.0))
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The hedging percentile of the service '" << service_name
+                       << "' must be in the range (0, 100]." << std::endl;
+        return false;
+    }
+
+    Config::logger << utils::Logger::Level::DEBUG
+                   << "Hedged requests enabled for service '" << service_name
+                   << "' after the p" << policy.percentile << " latency." << std::endl;
+
+    hedging = policy;
+    return true;
+}
+
+//==============================================================================
+bool parse_batching_policy(
+        const std::string& service_name,
+        const YAML::Node& node,
+        std::optional<ServiceBatcher::Policy>& batching)
+{
+    ServiceBatcher::Policy policy;
+
+    try
+    {
+        if (node.IsScalar())
+        {
+            if (!node.as<bool>())
+            {
+                return true;
+            }
+        }
+        else if (node.IsMap())
+        {
+            if (node["window_us"])
+            {
+                policy.window = std::chrono::microseconds(node["window_us"].as<uint32_t>());
+            }
+            if (node["max_size"])
+            {
+                policy.max_size = node["max_size"].as<std::size_t>();
+            }
+        }
+        else
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The 'batching' field of the service '" << service_name
+                           << "' must be either a boolean or a dictionary!" << std::endl;
+            return false;
+        }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'batching' configuration for the service '" << service_name
+                       << "': " << e.what() << std::endl;
+        return false;
+    }
+
+    if (policy.max_size == 0)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The batching 'max_size' of the service '" << service_name
+                       << "' must be greater than zero." << std::endl;
+        return false;
+    }
+
+    Config::logger << utils::Logger::Level::DEBUG
+                   << "Request batching enabled for service '" << service_name
+                   << "', with a window of " << policy.window.count() << " us and up to "
+                   << policy.max_size << " requests per batch." << std::endl;
+
+    batching = policy;
+    return true;
 }
 
 //==============================================================================
@@ -612,7 +831,7 @@ bool add_service_config(
         const std::map<std::string, ServiceRoute>& service_routes,
         std::map<std::string, ServiceConfig>& service_configs)
 {
-    return add_topic_or_service_config<ServiceConfig, ServiceRoute>(
+    const bool valid = add_topic_or_service_config<ServiceConfig, ServiceRoute>(
         "service", name, node, service_routes, service_configs,
         [=](ServiceConfig& config, std::string&& type)
         {
@@ -651,1129 +870,2871 @@ bool add_service_config(
         {
             return parse_service_route(route);
         });
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    ServiceConfig& config = service_configs.at(name);
+
+    if (node["hedging"] && !parse_hedging_policy(name, node["hedging"], config.hedging))
+    {
+        return false;
+    }
+
+    if (node["batching"] && !parse_batching_policy(name, node["batching"], config.batching))
+    {
+        return false;
+    }
+
+    if (config.hedging && config.batching)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The service '" << name << "' cannot have both 'hedging' "
+                       << "and 'batching' enabled." << std::endl;
+        return false;
+    }
+
+    return true;
 }
 
 //==============================================================================
-using ReadDictEntry =
-        std::function<bool (const std::string& key, const YAML::Node& value)>;
-
-bool read_dictionary(
-        const YAML::Node& config_node,
-        const std::string& field_name,
-        const std::string& filename,
-        const ReadDictEntry& read_fcn)
+bool parse_spin_policy(
+        const std::string& owner,
+        const YAML::Node& node,
+        SpinPolicy& policy)
 {
-    const YAML::Node& field = config_node[field_name];
-    if (field)
+    try
     {
-        if (!field.IsMap())
+        const YAML::Node& kind_node = node.IsMap() ? node["policy"] : node;
+        if (kind_node && !SpinPolicy::kind_from_string(kind_node.as<std::string>(), policy.kind))
         {
             Config::logger << utils::Logger::Level::ERROR
-                           << "The config file '" << filename << "' has a '"
-                           << field_name
-                           << "' field, but it is not pointing to a dictionary of "
-                // We use this to make the field name singular
-                           << field_name.substr(0, field_name.size() - 1)
-                           << "configurations!" << std::endl;
+                           << "Unknown spin policy '" << kind_node.as<std::string>() << "' for '" << owner
+                           << "'. Valid values are: busy_poll, yield, adaptive_backoff, blocking." << std::endl;
             return false;
         }
 
-        bool configs_okay = true;
-        for (YAML::const_iterator it = field.begin(); it != field.end(); ++it)
+        if (node.IsMap())
         {
-            configs_okay &= read_fcn(it->first.as<std::string>(), it->second);
+            if (node["max_backoff_us"])
+            {
+                policy.max_backoff = std::chrono::microseconds(node["max_backoff_us"].as<uint32_t>());
+            }
+            if (node["block_timeout_us"])
+            {
+                policy.block_timeout = std::chrono::microseconds(node["block_timeout_us"].as<uint32_t>());
+            }
         }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'spin' configuration for '" << owner << "': " << e.what() << std::endl;
+        return false;
+    }
 
-        if (!configs_okay)
-        {
-            Config::logger << utils::Logger::Level::ERROR
-                           << "Error found in an entry of the '" << field_name
-                           << "' dictionary of the config-file '" << filename << "'"
-                           << std::endl;
-            return false;
-        }
+    if (policy.max_backoff.count() == 0)
+    {
+        policy.max_backoff = std::chrono::microseconds(1);
     }
 
     return true;
 }
 
 //==============================================================================
-YAML::Node config_or_empty_node(
-        const std::string& key,
-        const std::map<std::string, YAML::Node>& map)
+bool parse_thread_settings(
+        const std::string& thread_name,
+        const YAML::Node& node,
+        ThreadSettings& settings)
 {
-    const auto it = map.find(key);
-    if (it == map.end())
+    try
     {
-        return YAML::Node();
-    }
+        if (node["name"])
+        {
+            settings.name = node["name"].as<std::string>();
+        }
 
-    return it->second;
-}
+        if (node["cpus"])
+        {
+            settings.cpus = node["cpus"].as<std::vector<int> >();
+        }
 
-//==============================================================================
-TopicInfo remap_if_needed(
-        const std::string& middleware,
-        const std::map<std::string, TopicInfo>& remap,
-        const TopicInfo& original)
-{
-    const auto it = remap.find(middleware);
-    if (it == remap.end())
-    {
-        return original;
-    }
+        if (node["priority"])
+        {
+            settings.priority = node["priority"].as<int>();
+        }
 
-    TopicInfo config = original;
-    if (!it->second.name.empty())
-    {
-        config.name = it->second.name;
+        if (node["numa_node"])
+        {
+            settings.numa_node = node["numa_node"].as<int>();
+            if (settings.numa_node < 0)
+            {
+                Config::logger << utils::Logger::Level::ERROR
+                               << "Invalid NUMA node " << settings.numa_node
+                               << " requested for the executor thread '" << thread_name << "'." << std::endl;
+                return false;
+            }
+        }
     }
-    if (!it->second.type.empty())
+    catch (const YAML::Exception& e)
     {
-        config.type = it->second.type;
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid settings for the executor thread '" << thread_name
+                       << "': " << e.what() << std::endl;
+        return false;
     }
-    if (!it->second.reply_type.empty())
+
+    for (const int cpu : settings.cpus)
     {
-        config.reply_type = it->second.reply_type;
+        if (cpu < 0)
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "Invalid CPU " << cpu << " requested for the executor thread '"
+                           << thread_name << "'." << std::endl;
+            return false;
+        }
     }
-    return config;
-}
 
-} //  anonymous namespace
+    if (settings.priority < 0 || settings.priority > 99)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The priority of the executor thread '" << thread_name
+                       << "' must be in the range [0, 99]." << std::endl;
+        return false;
+    }
 
-//==============================================================================
-utils::Logger Config::logger("is::core::Config");
+    return true;
+}
 
 //==============================================================================
-Config::Config(
+bool parse_realtime_settings(
         const YAML::Node& node,
-        const std::string& filename)
+        RealtimeSettings& realtime)
 {
-    if (node && !node.IsNull())
+    try
     {
-        parse(node, filename);
-    }
+        if (node.IsScalar())
+        {
+            realtime.enabled = node.as<bool>();
+            return true;
+        }
+
+        if (!node.IsMap())
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The 'realtime' field of the executor must be either a boolean "
+                           << "or a dictionary!" << std::endl;
+            return false;
+        }
+
+        realtime.enabled = node["enabled"] ? node["enabled"].as<bool>() : true;
+
+        if (node["lock_memory"])
+        {
+            realtime.lock_memory = node["lock_memory"].as<bool>();
+        }
+        if (node["prefault_stack_kb"])
+        {
+            realtime.prefault_stack = node["prefault_stack_kb"].as<std::size_t>() * 1024;
+        }
+        if (node["prefault_heap_mb"])
+        {
+            realtime.prefault_heap = node["prefault_heap_mb"].as<std::size_t>() * 1024 * 1024;
+        }
+        if (node["fail_on_page_fault"])
+        {
+            realtime.fail_on_page_fault = node["fail_on_page_fault"].as<bool>();
+        }
+        if (node["warmup_ms"])
+        {
+            realtime.warmup = std::chrono::milliseconds(node["warmup_ms"].as<uint32_t>());
+        }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'realtime' configuration for the executor: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
 }
 
 //==============================================================================
-Config Config::from_file(
-        const std::string& file)
+bool sort_by_dependencies(
+        const std::map<std::string, MiddlewareConfig>& middlewares,
+        std::vector<std::vector<std::string> >& levels)
 {
-    YAML::Node config_node;
-    try
-    {
-        config_node = YAML::LoadFile(file);
-    }
-    catch (const std::exception& e)
+    std::set<std::string> pending;
+    for (const auto& middleware : middlewares)
     {
-        logger << utils::Logger::Level::ERROR
-               << "Could not parse the config-file named '" << file
-               << "': " << e.what() << std::endl;
-        return Config();
+        pending.insert(middleware.first);
     }
 
-    if (!config_node)
+    std::set<std::string> sorted;
+    while (!pending.empty())
     {
-        logger << utils::Logger::Level::ERROR
-               << "Could not parse the config-file '" << file
-               << "'" << std::endl;
-        return Config();
+        /**
+         * A middleware joins the current level once all the middlewares in its `types-from`
+         * belong to the previous ones. Unknown references are reported while loading.
+         */
+        std::vector<std::string> level;
+        for (const std::string& name : pending)
+        {
+            const std::vector<std::string>& types_from = middlewares.at(name).types_from;
+            if (std::all_of(types_from.begin(), types_from.end(), [&](const std::string& from)
+                    {
+                        return from == name || sorted.count(from) || !middlewares.count(from);
+                    }))
+            {
+                level.push_back(name);
+            }
+        }
+
+        if (level.empty())
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The 'types-from' references of the following middlewares are circular:";
+            for (const std::string& name : pending)
+            {
+                Config::logger << " '" << name << "'";
+            }
+            Config::logger << std::endl;
+            return false;
+        }
+
+        for (const std::string& name : level)
+        {
+            pending.erase(name);
+            sorted.insert(name);
+        }
+
+        levels.emplace_back(std::move(level));
     }
 
-    return Config(config_node, file);
+    return true;
 }
 
 //==============================================================================
-bool Config::parse(
-        const YAML::Node& config_node,
-        const std::string& file)
+bool parse_metrics(
+        const YAML::Node& node,
+        const std::string& file,
+        MetricsConfig& metrics)
 {
-    _okay = false;
-
-    /**
-     * YAML formatting checks for Integration Service configuration.
-     */
-    if (!config_node.IsMap())
+    if (!node.IsMap())
     {
-        logger << utils::Logger::Level::ERROR
-               << "The config-file '" << file << "' needs to be a map "
-               << "containing 'systems', and possibly 'routes', 'topics', "
-               << "and/or 'services'!" << std::endl;
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The config-file '" << file << "' has a 'metrics' field, "
+                       << "but it is not a dictionary!" << std::endl;
         return false;
     }
 
-    const YAML::Node& systems = config_node["systems"];
-    if (!systems || !systems.IsMap())
+    try
     {
-        logger << utils::Logger::Level::ERROR
-               << "The config-file '" << file << "' is missing a "
-               << "dictionary for 'systems'! You must specify at least two "
-               << "systems in your config-file." << std::endl;
+        if (node["address"])
+        {
+            metrics.address = node["address"].as<std::string>();
+        }
+
+        if (node["port"])
+        {
+            metrics.port = node["port"].as<uint16_t>();
+        }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'metrics' configuration: " << e.what() << std::endl;
         return false;
     }
 
-    /**
-     * Iterates through systems and retrieves their 'type' (ros2, ros1, dds, websocket...)
-     * and the `types-from` attribute, if applicable.
-     */
-    for (YAML::const_iterator it = systems.begin(); it != systems.end(); ++it)
+    if (!metrics.port)
     {
-        const std::string middleware_alias = it->first.as<std::string>();
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The 'metrics' section of the config-file '" << file
+                       << "' must give the 'port' to listen on." << std::endl;
+        return false;
+    }
 
-        const YAML::Node& config = it->second;
+    return true;
+}
 
-        const YAML::Node& type_node = config["type"];
-        const std::string middleware = type_node ?
-                type_node.as<std::string>() : middleware_alias;
+//==============================================================================
+bool parse_tracing(
+        const YAML::Node& node,
+        const std::string& file,
+        std::optional<Tracer::Policy>& tracing)
+{
+    if (!node.IsMap())
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The config-file '" << file << "' has a 'tracing' field, "
+                       << "but it is not a dictionary!" << std::endl;
+        return false;
+    }
 
-        const YAML::Node& types_from_node = config["types-from"];
-        std::vector<std::string> types_from;
+    Tracer::Policy policy;
+    try
+    {
+        if (node["file"])
+        {
+            policy.file = node["file"].as<std::string>();
+        }
 
-        if (types_from_node)
+        if (node["sample_rate"])
         {
-            if (types_from_node.IsSequence())
-            {
-                for (const YAML::Node& types : types_from_node)
-                {
-                    types_from.push_back(types.as<std::string>());
-                }
-            }
-            else
-            {
-                types_from.push_back(types_from_node.as<std::string>());
-            }
+            policy.sample_rate = node["sample_rate"].as<double>();
         }
 
-        _m_middlewares.insert(
-            std::make_pair(
-                middleware_alias, MiddlewareConfig{middleware, types_from, config, config_node["types"]}));
-    }
+        if (node["max_file_size_mb"])
+        {
+            policy.max_file_size = node["max_file_size_mb"].as<std::size_t>() * 1024 * 1024;
+        }
 
-    if (_m_middlewares.size() < 2)
+        if (node["max_files"])
+        {
+            policy.max_files = node["max_files"].as<std::size_t>();
+        }
+    }
+    catch (const YAML::Exception& e)
     {
-        logger << utils::Logger::Level::ERROR
-               << "The config-file '" << file << "' does not specify enough "
-               << "middlewares '" << _m_middlewares.size() << "'! The "
-               << "minimum is 2." << std::endl;
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'tracing' configuration: " << e.what() << std::endl;
         return false;
     }
 
-    /**
-     * Retrieves types from the `types` section and adds them to the _m_types database.
-     */
-    if (!add_types(config_node, file, _m_types))
+    if (!(policy.sample_rate >= 0.0 && policy.sample_rate <= 1.0) || policy.max_file_size == 0)
     {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The 'tracing' section of the config-file '" << file
+                       << "' must give a 'sample_rate' between 0 and 1, "
+                       << "and a positive 'max_file_size_mb'." << std::endl;
         return false;
     }
 
-    /**
-     * Retrieves routes from the `routes` section and adds them to the _m_topic_routes
-     * or the _m_service_routes database accordingly.
-     */
-    auto read_route =
-            [&](const std::string& key, const YAML::Node& node) -> bool
-            {
-                return add_named_route(key, node, _m_topic_routes, _m_service_routes);
-            };
+    tracing = policy;
+    return true;
+}
 
-    if (!read_dictionary(config_node, "routes", file, read_route))
+//==============================================================================
+bool parse_profiler(
+        const YAML::Node& node,
+        const std::string& file,
+        ProfilerConfig& profiler)
+{
+    if (!node.IsMap())
     {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The config-file '" << file << "' has a 'profiler' field, "
+                       << "but it is not a dictionary!" << std::endl;
         return false;
     }
 
-    /**
-     * Retrieves topics from the `topics` section and adds them to the _m_topic_configs database.
-     */
-    auto read_topic =
-            [&](const std::string& key, const YAML::Node& node) -> bool
-            {
-                return add_topic_config(key, node, _m_topic_routes, _m_topic_configs);
-            };
+    try
+    {
+        profiler.enabled = node["enabled"] ? node["enabled"].as<bool>() : true;
 
-    if (!read_dictionary(config_node, "topics", file, read_topic))
+        if (node["report_size"])
+        {
+            profiler.report_size = node["report_size"].as<std::size_t>();
+        }
+    }
+    catch (const YAML::Exception& e)
     {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'profiler' configuration: " << e.what() << std::endl;
         return false;
     }
 
-    /**
-     * Retrieves services from the `services` section and adds them to the _m_service_configs database.
-     */
-    auto read_service =
-            [&](const std::string& key, const YAML::Node& node) -> bool
-            {
-                return add_service_config(key, node, _m_service_routes, _m_service_configs);
-            };
+    return true;
+}
 
-    if (!read_dictionary(config_node, "services", file, read_service))
+//==============================================================================
+bool parse_probes(
+        const YAML::Node& node,
+        const std::string& file,
+        const std::map<std::string, MiddlewareConfig>& middlewares,
+        std::map<std::string, ProbeConfig>& probes)
+{
+    if (!node.IsMap())
     {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The config-file '" << file << "' has a 'probes' field, "
+                       << "but it is not a dictionary!" << std::endl;
         return false;
     }
 
-    /**
-     * Checks topics configuration.
-     */
-    for (const auto& [topic_name, topic_config] : _m_topic_configs)
+    for (const auto& entry : node)
     {
-        /**
-         * Checks that the route associated to the topic is correct, in terms of
-         * the middlewares it connects being present in the `systems` section.
-         *
-         * The type will be added to the RequiredTypes map only if no remapping
-         * attributes are being set for this middleware.
-         */
-        const std::set<std::string>& middlewares = topic_config.route.all();
+        const std::string name = entry.first.as<std::string>();
+        const YAML::Node& probe_node = entry.second;
 
-        for (const std::string& mw : middlewares)
+        ProbeConfig probe;
+        try
         {
-            if (_m_middlewares.find(mw) == _m_middlewares.end())
+            if (probe_node["topic"])
             {
-                logger << utils::Logger::Level::ERROR
-                       << "Unrecognized system '" << mw << "' requested for topic '"
-                       << topic_name << "'." << std::endl;
-                return false;
+                probe.topic = probe_node["topic"].as<std::string>();
             }
 
-            auto it_mw_remap = topic_config.remap.find(mw);
-            if (it_mw_remap == topic_config.remap.end() || it_mw_remap->second.type.empty())
+            if (probe_node["from"])
             {
-                _m_required_types[mw].messages.insert(topic_config.message_type);
+                probe.from = probe_node["from"].as<std::string>();
             }
-        }
 
-        /**
-         * Also, checks that the remapping attributes are correctly defined, that is,
-         * remapping can only be done to one of the systems specified in the route.
-         */
-        for (auto&& [mw_name, topic_info] : topic_config.remap)
-        {
-            if (_m_middlewares.find(mw_name) == _m_middlewares.end())
+            if (probe_node["to"])
             {
-                logger << utils::Logger::Level::ERROR
-                       << "Unrecognized system '" << mw_name
-                       << "' requested for remapping topic "
-                       << "'" << topic_name << "'" << std::endl;
-                return false;
+                probe.to = probe_node["to"].as<std::string>();
             }
 
-            if (!topic_info.type.empty())
+            if (probe_node["period_ms"])
             {
-                _m_required_types[mw_name].messages.insert(topic_info.type);
+                probe.period = std::chrono::milliseconds(probe_node["period_ms"].as<uint32_t>());
             }
         }
-    }
+        catch (const YAML::Exception& e)
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "Invalid configuration for the probe '" << name << "': "
+                           << e.what() << std::endl;
+            return false;
+        }
 
-    /**
-     * Check services configuration.
-     */
-    for (const auto& [service_name, service_config] : _m_service_configs)
-    {
-        /**
-         * Checks that the route associated to the service is correct, in terms of
-         * the middlewares it connects being present in the `systems` section.
-         *
-         * The type will be added to the RequiredTypes map only if no remapping
-         * attributes are being set for this middleware.
-         */
-        const std::set<std::string>& middlewares = service_config.route.all();
-        for (const std::string& mw : middlewares)
+        if (probe.topic.empty() || (probe.from.empty() && probe.to.empty())
+                || probe.period.count() == 0)
         {
-            if (_m_middlewares.find(mw) == _m_middlewares.end())
-            {
-                logger << utils::Logger::Level::ERROR
-                       << "Unrecognized system '" << mw << "' requested for service "
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The probe '" << name << "' of the config-file '" << file
+                           << "' must give its 'topic', a positive 'period_ms', and at least "
+                           << "one of 'from' and 'to'." << std::endl;
+            return false;
+        }
+
+        for (const std::string* system : {&probe.from, &probe.to})
+        {
+            if (!system->empty() && middlewares.count(*system) == 0)
+            {
+                Config::logger << utils::Logger::Level::ERROR
+                               << "The probe '" << name << "' refers to the system '" << *system
+                               << "', which is not defined in the 'systems' section." << std::endl;
+                return false;
+            }
+        }
+
+        probes[name] = probe;
+    }
+
+    return true;
+}
+
+//==============================================================================
+bool add_probe_type(
+        std::map<std::string, eprosima::xtypes::DynamicType::Ptr>& types)
+{
+    if (types.count(LatencyProbe::TYPE_NAME) > 0)
+    {
+        return true;
+    }
+
+    eprosima::xtypes::idl::Context context;
+    eprosima::xtypes::idl::parse(LatencyProbe::TYPE_IDL, context);
+    if (!context.success)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Failed to define the '" << LatencyProbe::TYPE_NAME << "' type." << std::endl;
+        return false;
+    }
+
+    for (auto& type : context.get_all_scoped_types())
+    {
+        // As in `add_types`, the type is made available with and without the initial "::".
+        if (type.first.find("::") == 0)
+        {
+            types.emplace(std::make_pair(type.first.substr(2), type.second));
+        }
+        else
+        {
+            types.emplace(std::make_pair("::" + type.first, type.second));
+        }
+        types.insert(type);
+    }
+
+    return true;
+}
+
+//==============================================================================
+bool parse_shards(
+        const YAML::Node& node,
+        ShardsConfig& shards)
+{
+    try
+    {
+        if (node["count"])
+        {
+            shards.count = node["count"].as<std::size_t>();
+        }
+
+        if (node["queue_size"])
+        {
+            shards.queue_size = node["queue_size"].as<std::size_t>();
+        }
+
+        if (node["cpus"])
+        {
+            shards.cpus = node["cpus"].as<std::vector<int> >();
+        }
+    }
+    catch (const YAML::Exception& e)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "Invalid 'shards' field in the executor: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (shards.queue_size == 0)
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The 'queue_size' of the shards must be greater than zero." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+bool parse_executor(
+        const YAML::Node& node,
+        const std::string& file,
+        const std::map<std::string, MiddlewareConfig>& middlewares,
+        ExecutorConfig& executor)
+{
+    if (!node.IsMap())
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The config-file '" << file << "' has an 'executor' field, "
+                       << "but it is not a dictionary!" << std::endl;
+        return false;
+    }
+
+    if (node["reactor"] && !parse_thread_settings("reactor", node["reactor"], executor.reactor))
+    {
+        return false;
+    }
+
+    if (node["realtime"] && !parse_realtime_settings(node["realtime"], executor.realtime))
+    {
+        return false;
+    }
+
+    if (node["shards"] && !parse_shards(node["shards"], executor.shards))
+    {
+        return false;
+    }
+
+    if (!parse_optional_field(node, "parallel_startup", "the executor", "a boolean", executor.parallel_startup)
+            || !parse_optional_field(node, "drain_timeout_ms", "the executor", "a positive integer",
+            executor.drain_timeout)
+            || !parse_optional_field(node, "stall_threshold_ms", "the executor", "a positive integer",
+            executor.stall_threshold))
+    {
+        return false;
+    }
+
+    if (node["default_cpus"] || node["default_numa_node"])
+    {
+        YAML::Node default_node;
+        if (node["default_cpus"])
+        {
+            default_node["cpus"] = node["default_cpus"];
+        }
+        if (node["default_numa_node"])
+        {
+            default_node["numa_node"] = node["default_numa_node"];
+        }
+
+        if (!parse_thread_settings("default", default_node, executor.default_settings))
+        {
+            return false;
+        }
+    }
+
+    const YAML::Node& threads = node["threads"];
+    if (!threads)
+    {
+        return true;
+    }
+
+    if (!threads.IsSequence())
+    {
+        Config::logger << utils::Logger::Level::ERROR
+                       << "The 'threads' field of the executor must be a list!" << std::endl;
+        return false;
+    }
+
+    std::set<std::string> assigned;
+
+    for (const YAML::Node& thread : threads)
+    {
+        ExecutorThreadConfig config;
+        config.settings.name = "is-worker-" + std::to_string(executor.threads.size());
+
+        if (!thread.IsMap() || !parse_thread_settings(config.settings.name, thread, config.settings))
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "Invalid entry in the 'threads' list of the executor." << std::endl;
+            return false;
+        }
+
+        try
+        {
+            if (thread["systems"])
+            {
+                config.systems = thread["systems"].as<std::vector<std::string> >();
+            }
+        }
+        catch (const YAML::Exception& e)
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "Invalid 'systems' for the executor thread '" << config.settings.name
+                           << "': " << e.what() << std::endl;
+            return false;
+        }
+
+        if (thread["spin"] && !parse_spin_policy(config.settings.name, thread["spin"], config.spin))
+        {
+            return false;
+        }
+
+        if (config.systems.empty())
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The executor thread '" << config.settings.name
+                           << "' does not list any system to run." << std::endl;
+            return false;
+        }
+
+        for (const std::string& system : config.systems)
+        {
+            if (middlewares.find(system) == middlewares.end())
+            {
+                Config::logger << utils::Logger::Level::ERROR
+                               << "Unrecognized system '" << system << "' requested for the executor thread '"
+                               << config.settings.name << "'." << std::endl;
+                return false;
+            }
+
+            if (!assigned.insert(system).second)
+            {
+                Config::logger << utils::Logger::Level::ERROR
+                               << "The system '" << system << "' is assigned to more than one executor thread."
+                               << std::endl;
+                return false;
+            }
+
+            if (middlewares.at(system).config_node["spin"])
+            {
+                Config::logger << utils::Logger::Level::WARN
+                               << "The 'spin' policy of the system '" << system << "' is ignored, since it is "
+                               << "run by the executor thread '" << config.settings.name
+                               << "', which follows its own 'spin' policy." << std::endl;
+            }
+        }
+
+        executor.threads.emplace_back(std::move(config));
+    }
+
+    return true;
+}
+
+//==============================================================================
+using ReadDictEntry =
+        std::function<bool (const std::string& key, const YAML::Node& value)>;
+
+bool read_dictionary(
+        const YAML::Node& config_node,
+        const std::string& field_name,
+        const std::string& filename,
+        const ReadDictEntry& read_fcn)
+{
+    const YAML::Node& field = config_node[field_name];
+    if (field)
+    {
+        if (!field.IsMap())
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "The config file '" << filename << "' has a '"
+                           << field_name
+                           << "' field, but it is not pointing to a dictionary of "
+                // We use this to make the field name singular
+                           << field_name.substr(0, field_name.size() - 1)
+                           << "configurations!" << std::endl;
+            return false;
+        }
+
+        bool configs_okay = true;
+        for (YAML::const_iterator it = field.begin(); it != field.end(); ++it)
+        {
+            configs_okay &= read_fcn(it->first.as<std::string>(), it->second);
+        }
+
+        if (!configs_okay)
+        {
+            Config::logger << utils::Logger::Level::ERROR
+                           << "Error found in an entry of the '" << field_name
+                           << "' dictionary of the config-file '" << filename << "'"
+                           << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//==============================================================================
+YAML::Node config_or_empty_node(
+        const std::string& key,
+        const std::map<std::string, YAML::Node>& map)
+{
+    const auto it = map.find(key);
+    if (it == map.end())
+    {
+        return YAML::Node();
+    }
+
+    return it->second;
+}
+
+//==============================================================================
+/**
+ * @brief Converts a duration into nanoseconds, to be passed to the tracepoints.
+ */
+[[maybe_unused]] int64_t to_nanoseconds(
+        std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+//==============================================================================
+TopicInfo remap_if_needed(
+        const std::string& middleware,
+        const std::map<std::string, TopicInfo>& remap,
+        const TopicInfo& original)
+{
+    const auto it = remap.find(middleware);
+    if (it == remap.end())
+    {
+        return original;
+    }
+
+    TopicInfo config = original;
+    if (!it->second.name.empty())
+    {
+        config.name = it->second.name;
+    }
+    if (!it->second.type.empty())
+    {
+        config.type = it->second.type;
+    }
+    if (!it->second.reply_type.empty())
+    {
+        config.reply_type = it->second.reply_type;
+    }
+    return config;
+}
+
+} //  anonymous namespace
+
+//==============================================================================
+utils::Logger Config::logger("is::core::Config");
+
+//==============================================================================
+Config::Config(
+        const YAML::Node& node,
+        const std::string& filename)
+{
+    if (node && !node.IsNull())
+    {
+        parse(node, filename);
+    }
+}
+
+//==============================================================================
+Config Config::from_file(
+        const std::string& file)
+{
+    YAML::Node config_node;
+    try
+    {
+        config_node = YAML::LoadFile(file);
+    }
+    catch (const std::exception& e)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Could not parse the config-file named '" << file
+               << "': " << e.what() << std::endl;
+        return Config();
+    }
+
+    if (!config_node)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Could not parse the config-file '" << file
+               << "'" << std::endl;
+        return Config();
+    }
+
+    return Config(config_node, file);
+}
+
+//==============================================================================
+bool Config::parse(
+        const YAML::Node& config_node,
+        const std::string& file)
+{
+    _okay = false;
+
+    /**
+     * YAML formatting checks for Integration Service configuration.
+     */
+    if (!config_node.IsMap())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "The config-file '" << file << "' needs to be a map "
+               << "containing 'systems', and possibly 'routes', 'topics', "
+               << "and/or 'services'!" << std::endl;
+        return false;
+    }
+
+    /**
+     * Keeps a copy of the configuration, to be compared against the new one if the instance gets reloaded.
+     */
+    _m_node = YAML::Clone(config_node);
+
+    const YAML::Node& systems = config_node["systems"];
+    if (!systems || !systems.IsMap())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "The config-file '" << file << "' is missing a "
+               << "dictionary for 'systems'! You must specify at least two "
+               << "systems in your config-file." << std::endl;
+        return false;
+    }
+
+    /**
+     * Iterates through systems and retrieves their 'type' (ros2, ros1, dds, websocket...)
+     * and the `types-from` attribute, if applicable.
+     */
+    for (YAML::const_iterator it = systems.begin(); it != systems.end(); ++it)
+    {
+        const std::string middleware_alias = it->first.as<std::string>();
+
+        const YAML::Node config = it->second;
+
+        const YAML::Node& type_node = config["type"];
+        const std::string middleware = type_node ?
+                type_node.as<std::string>() : middleware_alias;
+
+        const YAML::Node& types_from_node = config["types-from"];
+        std::vector<std::string> types_from;
+
+        if (types_from_node)
+        {
+            if (types_from_node.IsSequence())
+            {
+                for (const YAML::Node& types : types_from_node)
+                {
+                    types_from.push_back(types.as<std::string>());
+                }
+            }
+            else
+            {
+                types_from.push_back(types_from_node.as<std::string>());
+            }
+        }
+
+        SpinPolicy spin;
+        if (config["spin"] && !parse_spin_policy(middleware_alias, config["spin"], spin))
+        {
+            return false;
+        }
+
+        _m_middlewares.insert(
+            std::make_pair(
+                middleware_alias, MiddlewareConfig{middleware, types_from, config, config_node["types"], spin}));
+    }
+
+    if (_m_middlewares.size() < 2)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "The config-file '" << file << "' does not specify enough "
+               << "middlewares '" << _m_middlewares.size() << "'! The "
+               << "minimum is 2." << std::endl;
+        return false;
+    }
+
+    /**
+     * Retrieves types from the `types` section and adds them to the _m_types database.
+     * The memory they take is charged to the `types` account.
+     */
+    utils::MemoryTracker::Account* const types_account = utils::MemoryTracker::account("types");
+    {
+        const utils::MemoryTracker::Scope memory(types_account);
+        if (!add_types(config_node, file, _m_types))
+        {
+            return false;
+        }
+    }
+
+    /**
+     * Retrieves routes from the `routes` section and adds them to the _m_topic_routes
+     * or the _m_service_routes database accordingly.
+     */
+    auto read_route =
+            [&](const std::string& key, const YAML::Node& node) -> bool
+            {
+                return add_named_route(key, node, _m_topic_routes, _m_service_routes);
+            };
+
+    if (!read_dictionary(config_node, "routes", file, read_route))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves topics from the `topics` section and adds them to the _m_topic_configs database.
+     */
+    auto read_topic =
+            [&](const std::string& key, const YAML::Node& node) -> bool
+            {
+                return add_topic_config(key, node, _m_topic_routes, _m_topic_configs);
+            };
+
+    if (!read_dictionary(config_node, "topics", file, read_topic))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves services from the `services` section and adds them to the _m_service_configs database.
+     */
+    auto read_service =
+            [&](const std::string& key, const YAML::Node& node) -> bool
+            {
+                return add_service_config(key, node, _m_service_routes, _m_service_configs);
+            };
+
+    if (!read_dictionary(config_node, "services", file, read_service))
+    {
+        return false;
+    }
+
+    /**
+     * Checks topics configuration.
+     */
+    for (const auto& [topic_name, topic_config] : _m_topic_configs)
+    {
+        /**
+         * Checks that the route associated to the topic is correct, in terms of
+         * the middlewares it connects being present in the `systems` section.
+         *
+         * The type will be added to the RequiredTypes map only if no remapping
+         * attributes are being set for this middleware.
+         */
+        const std::set<std::string>& middlewares = topic_config.route.all();
+
+        for (const std::string& mw : middlewares)
+        {
+            if (_m_middlewares.find(mw) == _m_middlewares.end())
+            {
+                logger << utils::Logger::Level::ERROR
+                       << "Unrecognized system '" << mw << "' requested for topic '"
+                       << topic_name << "'." << std::endl;
+                return false;
+            }
+
+            auto it_mw_remap = topic_config.remap.find(mw);
+            if (it_mw_remap == topic_config.remap.end() || it_mw_remap->second.type.empty())
+            {
+                _m_required_types[mw].messages.insert(topic_config.message_type);
+            }
+        }
+
+        /**
+         * Also, checks that the remapping attributes are correctly defined, that is,
+         * remapping can only be done to one of the systems specified in the route.
+         */
+        for (auto&& [mw_name, topic_info] : topic_config.remap)
+        {
+            if (_m_middlewares.find(mw_name) == _m_middlewares.end())
+            {
+                logger << utils::Logger::Level::ERROR
+                       << "Unrecognized system '" << mw_name
+                       << "' requested for remapping topic "
+                       << "'" << topic_name << "'" << std::endl;
+                return false;
+            }
+
+            if (!topic_info.type.empty())
+            {
+                _m_required_types[mw_name].messages.insert(topic_info.type);
+            }
+        }
+    }
+
+    /**
+     * Check services configuration.
+     */
+    for (const auto& [service_name, service_config] : _m_service_configs)
+    {
+        /**
+         * Checks that the route associated to the service is correct, in terms of
+         * the middlewares it connects being present in the `systems` section.
+         *
+         * The type will be added to the RequiredTypes map only if no remapping
+         * attributes are being set for this middleware.
+         */
+        const std::set<std::string>& middlewares = service_config.route.all();
+        for (const std::string& mw : middlewares)
+        {
+            if (_m_middlewares.find(mw) == _m_middlewares.end())
+            {
+                logger << utils::Logger::Level::ERROR
+                       << "Unrecognized system '" << mw << "' requested for service "
+                       << "'" << service_name << "'" << std::endl;
+                return false;
+            }
+
+            auto it_mw_remap = service_config.remap.find(mw);
+            if ((it_mw_remap == service_config.remap.end() || it_mw_remap->second.type == "") &&
+                    service_config.request_type != "")
+            {
+                _m_required_types[mw].services.insert(service_config.request_type);
+            }
+            if ((it_mw_remap == service_config.remap.end() || it_mw_remap->second.reply_type == "") &&
+                    service_config.reply_type != "")
+            {
+                _m_required_types[mw].services.insert(service_config.reply_type);
+            }
+        }
+
+        /**
+         * Also, checks that the remapping attributes are correctly defined, that is,
+         * remapping can only be done to one of the systems specified in the route.
+         */
+        for (auto&& [mw_name, service_info] : service_config.remap)
+        {
+            if (_m_middlewares.find(mw_name) == _m_middlewares.end())
+            {
+                logger << utils::Logger::Level::ERROR
+                       << "Unrecognized system '" << mw_name << "' requested for remapping service "
                        << "'" << service_name << "'" << std::endl;
                 return false;
             }
+            _m_required_types[mw_name].services.insert(service_info.type);
+            if (!service_info.reply_type.empty())
+            {
+                _m_required_types[mw_name].services.insert(service_info.reply_type);
+            }
+        }
+    }
+
+    /**
+     * Retrieves the threads configuration from the `executor` section, if any.
+     */
+    if (config_node["executor"]
+            && !parse_executor(config_node["executor"], file, _m_middlewares, _m_executor))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves the metrics endpoint configuration, if any.
+     */
+    if (config_node["metrics"] && !parse_metrics(config_node["metrics"], file, _m_metrics))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves the tracing configuration, if any.
+     */
+    if (config_node["tracing"] && !parse_tracing(config_node["tracing"], file, _m_tracing))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves the profiler configuration, if any.
+     */
+    if (config_node["profiler"] && !parse_profiler(config_node["profiler"], file, _m_profiler))
+    {
+        return false;
+    }
+
+    /**
+     * Retrieves the latency probes, if any. Their systems need the type of the probe messages.
+     */
+    if (config_node["probes"])
+    {
+        const utils::MemoryTracker::Scope memory(types_account);
+        if (!parse_probes(config_node["probes"], file, _m_middlewares, _m_probes)
+                || !add_probe_type(_m_types))
+        {
+            return false;
+        }
+
+        for (const auto& [name, probe] : _m_probes)
+        {
+            for (const std::string& mw : {probe.from, probe.to})
+            {
+                if (!mw.empty())
+                {
+                    _m_required_types[mw].messages.insert(LatencyProbe::TYPE_NAME);
+                }
+            }
+
+            /**
+             * Routes ignore the messages that their source systems published themselves,
+             * so a probe sent by a source of the probed route would never cross it.
+             */
+            for (const auto& [topic_name, topic_config] : _m_topic_configs)
+            {
+                const bool probed = topic_config.route.from.count(probe.from) > 0
+                        && remap_if_needed(probe.from, topic_config.remap,
+                                TopicInfo(topic_name, topic_config.message_type)).name == probe.topic;
+                if (probed)
+                {
+                    logger << utils::Logger::Level::ERROR
+                           << "The probe '" << name << "' cannot be sent from the system '" << probe.from
+                           << "', which is a source of the topic '" << topic_name
+                           << "' that routes it: its own messages would be ignored. "
+                           << "Send it from another system of the same middleware." << std::endl;
+                    return false;
+                }
+            }
+        }
+    }
+
+    /**
+     * Checks for defined but unused middlewares. Also, checks that at least two are being used.
+     */
+    std::size_t active_mw_count = 0;
+    for (const auto& [mw_name, mw_config] : _m_middlewares)
+    {
+        const auto it = _m_required_types.find(mw_name);
+        if (it == _m_required_types.end())
+        {
+            logger << utils::Logger::Level::WARN
+                   << "The middleware '" << mw_name << "' of type '"
+                   << mw_config.type << "' is not being used in any topics "
+                   << "or services" << std::endl;
+        }
+        else
+        {
+            ++active_mw_count;
+        }
+    }
+
+    if (active_mw_count < 2)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Fewer than 2 middlewares (" << active_mw_count << ") are "
+               << "being used in this current configuration! This means that "
+               << "running Integration Service will not be useful." << std::endl;
+        return false;
+    }
+
+    _okay = true;
+    return true;
+}
+
+//==============================================================================
+bool Config::okay() const
+{
+    return _okay;
+}
+
+//==============================================================================
+Config::operator bool() const
+{
+    return _okay;
+}
+
+//==============================================================================
+const ExecutorConfig& Config::executor() const
+{
+    return _m_executor;
+}
+
+//==============================================================================
+bool Config::startup_levels(
+        std::vector<std::vector<std::string> >& levels) const
+{
+    return sort_by_dependencies(_m_middlewares, levels);
+}
+
+//==============================================================================
+const MetricsConfig& Config::metrics() const
+{
+    return _m_metrics;
+}
+
+//==============================================================================
+const std::optional<Tracer::Policy>& Config::tracing() const
+{
+    return _m_tracing;
+}
+
+//==============================================================================
+const ProfilerConfig& Config::profiler() const
+{
+    return _m_profiler;
+}
+
+//==============================================================================
+SpinPolicy Config::spin_policy(
+        const std::string& middleware) const
+{
+    const auto it = _m_middlewares.find(middleware);
+    return it == _m_middlewares.end() ? SpinPolicy() : it->second.spin;
+}
+
+//==============================================================================
+bool Config::changes_from(
+        const Config& running,
+        ConfigChanges& changes) const
+{
+    const auto dump = [](const YAML::Node& node) -> std::string
+            {
+                return node ? YAML::Dump(node) : std::string();
+            };
+
+    /**
+     * The SystemHandles and their types cannot be replaced while running.
+     */
+    for (const char* section : {"systems", "types"})
+    {
+        if (dump(_m_node[section]) != dump(running._m_node[section]))
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "The '" << section << "' section of the configuration cannot be changed "
+                   << "while running. Please restart the instance instead." << std::endl;
+            return false;
+        }
+    }
+
+    for (const char* section : {"executor", "metrics", "tracing", "profiler", "probes"})
+    {
+        if (dump(_m_node[section]) != dump(running._m_node[section]))
+        {
+            logger << utils::Logger::Level::WARN
+                   << "The changes in the '" << section << "' section of the configuration "
+                   << "will not be applied until the instance gets restarted." << std::endl;
+        }
+    }
+
+    /**
+     * The topics and services are compared by their own configuration and by their routes,
+     * since they can refer to a named route that could have changed as well.
+     */
+    const auto diff = [&](
+        const char* section,
+        const auto& current,
+        const auto& previous,
+        const auto& same_route,
+        std::vector<std::string>& removed,
+        std::vector<std::string>& added)
+            {
+                for (const auto& [name, config] : previous)
+                {
+                    const auto it = current.find(name);
+                    if (it == current.end()
+                            || !same_route(it->second.route, config.route)
+                            || dump(_m_node[section][name]) != dump(running._m_node[section][name]))
+                    {
+                        removed.push_back(name);
+                    }
+                }
+
+                for (const auto& [name, config] : current)
+                {
+                    const auto it = previous.find(name);
+                    if (it == previous.end()
+                            || std::find(removed.begin(), removed.end(), name) != removed.end())
+                    {
+                        added.push_back(name);
+                    }
+                }
+            };
+
+    changes = ConfigChanges();
+
+    diff("topics", _m_topic_configs, running._m_topic_configs,
+        [](const TopicRoute& a, const TopicRoute& b)
+        {
+            return a.from == b.from && a.to == b.to;
+        },
+        changes.topics_removed, changes.topics_added);
+
+    diff("services", _m_service_configs, running._m_service_configs,
+        [](const ServiceRoute& a, const ServiceRoute& b)
+        {
+            return a.server == b.server && a.clients == b.clients;
+        },
+        changes.services_removed, changes.services_added);
+
+    return true;
+}
+
+//==============================================================================
+bool Config::load_middlewares(
+        is::internal::SystemHandleInfoMap& info_map) const
+{
+    /**
+     * Sorts middlewares according to their dependencies in the `types-from` department.
+     * Middlewares specified in a `types-from` tag must be configured first, so they are
+     * grouped in levels, each of them depending only on the previous ones.
+     */
+    std::vector<std::vector<std::string> > levels;
+    if (!startup_levels(levels))
+    {
+        return false;
+    }
+
+    /**
+     * Iterates through the levels, to load them in the appropriate order.
+     * With `parallel_startup`, the middlewares of a level get loaded and configured concurrently.
+     */
+    for (const std::vector<std::string>& level : levels)
+    {
+        std::vector<is::internal::SystemHandleInfo> infos;
+        infos.reserve(level.size());
+
+        if (_m_executor.parallel_startup && level.size() > 1)
+        {
+            std::vector<std::future<is::internal::SystemHandleInfo> > results;
+            results.reserve(level.size());
+
+            for (const std::string& mw_name : level)
+            {
+                results.emplace_back(std::async(std::launch::async, [this, &mw_name, &info_map]()
+                        {
+                            return load_middleware(mw_name, info_map);
+                        }));
+            }
+
+            for (auto& result : results)
+            {
+                infos.emplace_back(result.get());
+            }
+        }
+        else
+        {
+            for (const std::string& mw_name : level)
+            {
+                infos.emplace_back(load_middleware(mw_name, info_map));
+                if (!infos.back())
+                {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * The loaded middlewares are inserted once the whole level is done,
+         * since the middlewares of the following levels take types from them.
+         */
+        bool valid = true;
+        for (std::size_t i = 0; i < level.size(); ++i)
+        {
+            if (infos[i])
+            {
+                info_map.insert(std::make_pair(level[i], std::move(infos[i])));
+            }
+            else
+            {
+                valid = false;
+            }
+        }
+
+        if (!valid)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//==============================================================================
+is::internal::SystemHandleInfo Config::load_middleware(
+        const std::string& mw_name,
+        const is::internal::SystemHandleInfoMap& info_map) const
+{
+    using Entry = std::map<std::string, MiddlewareConfig>::value_type;
+
+    const MiddlewareConfig& mw_config = _m_middlewares.at(mw_name);
+
+    /**
+     * Everything the middleware allocates while loading, such as its type registry,
+     * is charged to its system.
+     */
+    const utils::MemoryTracker::Scope memory(utils::MemoryTracker::account("system:" + mw_name));
+
+    const auto& ref_mw_name = mw_name;
+    const std::string& middleware_type = mw_config.type;
+
+    logger << utils::Logger::Level::DEBUG
+           << "Config::load_middlewares: looking for middleware '" << mw_name
+           << "' with type '" << middleware_type << "'" << std::endl;
+
+    const Search search(mw_config.type);
+
+    /**
+     * Looks for the middleware's SystemHandle dynamic library.
+     */
+    std::vector<std::string> checked_paths;
+    const std::string path = search.find_middleware_mix(&checked_paths);
+
+    if (path.empty())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Unable to find .mix file for middleware '" << middleware_type << "'. "
+               << "The following locations were checked unsuccessfully: \n";
+
+        for (const std::string& checked_path : checked_paths)
+        {
+            logger << "\n\t- " << checked_path;
+        }
+
+        logger << "\nTry adding your middleware's install path to IS_PREFIX_PATH "
+               << "or IS_" << Search::to_env_format(middleware_type) << "_PREFIX_PATH "
+               << "environment variables." << std::endl;
+
+        return is::internal::SystemHandleInfo(nullptr);
+    }
+
+    if (!Mix::from_file(path).load())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Unable to load the dynamic libraries present in the .mix file '"
+               << path << "'." << std::endl;
+
+        return is::internal::SystemHandleInfo(nullptr);
+    }
+
+    /**
+     * After loading the mix file, the middleware's SystemHandle library should be
+     * loaded, and it should be possible to find the middleware info in the
+     * internal Register.
+     */
+    is::internal::SystemHandleInfo info = is::internal::Register::get(middleware_type);
+
+    if (!info || !info.handle->preprocess_types(mw_config.types_node))
+    {
+        return is::internal::SystemHandleInfo(nullptr);
+    }
+
+    /**
+     * Now, it iterates the middleware required types map.
+     * For each middleware, it checks which types it needs, and places them into
+     * the SystemHandleInfo structure.
+     */
+    const auto requirements = _m_required_types.find(mw_name);
+
+    if (requirements != _m_required_types.end())
+    {
+        /**
+         * Adds topics message types into the type registry, avoiding to insert duplicates.
+         */
+        for (const std::string& required_type : requirements->second.messages)
+        {
+            auto type_it = _m_types.find(required_type);
+
+            if (type_it != _m_types.end())
+            {
+                info.types.emplace(*type_it);
+            }
+        }
 
-            auto it_mw_remap = service_config.remap.find(mw);
-            if ((it_mw_remap == service_config.remap.end() || it_mw_remap->second.type == "") &&
-                    service_config.request_type != "")
+        /**
+         * Adds service types into the type registry, avoiding to insert duplicates.
+         */
+        for (const std::string& required_type : requirements->second.services)
+        {
+            auto type_it = _m_types.find(required_type);
+
+            if (type_it != _m_types.end())
             {
-                _m_required_types[mw].services.insert(service_config.request_type);
+                info.types.emplace(*type_it);
             }
-            if ((it_mw_remap == service_config.remap.end() || it_mw_remap->second.reply_type == "") &&
-                    service_config.reply_type != "")
+        }
+
+        /**
+         * Checks here the `types-from` attribute for this middleware.
+         * If it exists, it will contain a list of the middlewares it wants to
+         * import the types from.
+         *
+         * Check that this middleware already exists in the
+         * is::internal::SystemHandleInfoMap, and iterate over its types to copy them into the
+         * target middleware, that is, `mw_name`.
+         */
+        if (!mw_config.types_from.empty())
+        {
+            for (const std::string& mw_from : mw_config.types_from)
             {
-                _m_required_types[mw].services.insert(service_config.reply_type);
+                const auto it = info_map.find(mw_from);
+                if (it == info_map.end())
+                {
+                    logger << utils::Logger::Level::ERROR
+                           << "'types-from' references to a non-existent middleware: '"
+                           << mw_from << "'. Maybe it has not been registered yet?"
+                           << std::endl;
+
+                    return is::internal::SystemHandleInfo(nullptr);
+                }
+
+                for (auto&& it_type : info_map.at(mw_from).types)
+                {
+                    info.types.emplace(it_type.second->name(), it_type.second);
+                }
+            }
+
+            /**
+             * Now that we have added types from the `types-from` tag, the
+             * SystemHandleInfo struct for this middleware (mw_name) should be complete.
+             *
+             * Therefore, iterating through its required_types and checking that every
+             * type exists in the SystemHandleInfo::TypeRegistry should be ok. Otherwise,
+             * it warns and returns false.
+             */
+            for (const std::string& required_type : requirements->second.messages)
+            {
+                if (!info.types.count(required_type))
+                {
+                    logger << utils::Logger::Level::ERROR
+                           << "The middleware '" << mw_name
+                           << "' must satisfy the required topic type '"
+                           << required_type << "', but it does not seem to be "
+                           << "available neither in its type registry or inherited "
+                           << "from its 'types-from' reference middlewares" 
+                           << info.types
+                           << std::endl;
+
+                    return is::internal::SystemHandleInfo(nullptr);
+                }
+            }
+
+            for (const std::string& required_type : requirements->second.services)
+            {
+                if (!info.types.count(required_type))
+                {
+                    logger << utils::Logger::Level::ERROR
+                           << "The middleware '" << mw_name
+                           << "' must satisfy the required service type '"
+                           << required_type << "', but it does not seem to be "
+                           << "available neither in its type registry or inherited "
+                           << "from its 'types-from' reference middlewares" << std::endl;
+
+                    return is::internal::SystemHandleInfo(nullptr);
+                }
             }
         }
+    }
+    else
+    {
+        // Check if another middleware relies on types builtin or dynamically loaded by the middleware but not
+        // explicit in the configuration file
+        if ( _m_middlewares.end() ==
+                std::find_if(_m_middlewares.begin(), _m_middlewares.end(), [&ref_mw_name](const Entry& mw)
+                {
+                    auto& from = mw.second.types_from;
+                    return ref_mw_name != mw.first && std::find(from.begin(), from.end(), ref_mw_name) != from.end();
+                }))
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "The middleware '" << mw_name
+                   << "' has no types associated" << std::endl;
+            return is::internal::SystemHandleInfo(nullptr);
+        }
+    }
+
+    /**
+     * Finally, now that the SystemHandleInfo struct is filled with all its types, it
+     * calls to the SystemHandle::configure override function for the selected middleware.
+     */
+    if (!info.handle->configure(
+                requirements->second, mw_config.config_node, info.types))
+    {
+        logger << utils::Logger::Level::ERROR
+               << "The middleware '" << mw_name
+               << "' configuration step failed" << std::endl;
+        return is::internal::SystemHandleInfo(nullptr);
+    }
+
+    return info;
+}
+
+//==============================================================================
+bool Config::configure_topics(
+        const is::internal::SystemHandleInfoMap& info_map,
+        SubscriptionCallbacks& subscription_callbacks,
+        RuntimeContext& runtime) const
+{
+    bool valid = true;
+
+    /**
+     * Iterates through the topics section of the provided configuration.
+     */
+    for (const auto& topic : _m_topic_configs)
+    {
+        valid &= configure_topic(info_map, topic.first, subscription_callbacks, runtime);
+    }
+
+    return valid;
+}
+
+//==============================================================================
+bool Config::configure_topic(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const std::string& topic_name,
+        SubscriptionCallbacks& subscription_callbacks,
+        RuntimeContext& runtime) const
+{
+    const auto it_topic = _m_topic_configs.find(topic_name);
+    if (it_topic == _m_topic_configs.end())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Trying to configure the topic '" << topic_name
+               << "', which is not part of the configuration." << std::endl;
+        return false;
+    }
+
+    const TopicConfig& topic_config = it_topic->second;
+    bool valid = true;
+
+    /**
+     * First, it checks topic compatibility in terms of the registered types
+     * in the source and destination endpoints.
+     */
+    if (!check_topic_compatibility(info_map, topic_name, topic_config))
+    {
+        return false;
+    }
+
+    /**
+     * Every callback of the topic shares the same gate, so that the whole route
+     * can be disabled at once if the topic gets removed while reloading.
+     */
+    const RuntimeContext::RouteGate gate = runtime.open_route(RuntimeContext::topic_route(topic_name));
+    const std::string route = RuntimeContext::topic_route(topic_name);
+    const std::shared_ptr<RouteMetrics> metrics = runtime.route_metrics(route);
+    Tracer* const tracer = runtime.tracer.get();
+    utils::MemoryTracker::Account* const account = utils::MemoryTracker::account(route);
+
+    /**
+     * Helper struct to store an Integration Service publisher
+     * and its published DynamicType.
+     */
+    struct PublisherData
+    {
+        PublisherData(
+                const std::string& m_system,
+                std::shared_ptr<TopicPublisher> m_publisher,
+                const eprosima::xtypes::DynamicType& m_type)
+            : system(m_system)
+            , publisher(m_publisher)
+            , type(m_type)
+        {
+        }
+
+        std::string system;
+        std::shared_ptr<TopicPublisher> publisher;
+        const eprosima::xtypes::DynamicType& type;
+    };
 
+    std::vector<PublisherData> publishers;
+    publishers.reserve(topic_config.route.to.size());
+
+    for (const std::string& to : topic_config.route.to)
+    {
         /**
-         * Also, checks that the remapping attributes are correctly defined, that is,
-         * remapping can only be done to one of the systems specified in the route.
+         * The `to` endpoint within the route tells the related system that
+         * its SystemHandle must produce a publisher, so that the final application
+         * can subscribe to it and receive the information as described in the route
+         * data flow. Therefore, this middleware must have publishing capabilities,
+         * that is, its SystemHandleInfo::TopicPublisherSystem pointer must not be NULL.
          */
-        for (auto&& [mw_name, service_info] : service_config.remap)
+        const auto it_to = info_map.find(to);
+        if (it_to == info_map.end() || !it_to->second.topic_publisher)
         {
-            if (_m_middlewares.find(mw_name) == _m_middlewares.end())
+            logger << utils::Logger::Level::ERROR
+                   << "Could not find topic publishing capabilities for system "
+                   << "named '" << to << "', requested for topic '"
+                   << topic_name << "'." << std::endl;
+
+            valid = false;
+            continue;
+        }
+
+        /**
+         * Does remapping and type resolution, if applicable.
+         */
+        TopicInfo topic_info = remap_if_needed(
+            to, topic_config.remap, TopicInfo(topic_name, topic_config.message_type));
+
+        const eprosima::xtypes::DynamicType* pub_type = resolve_type(
+            it_to->second.types, topic_info.type);
+
+        /**
+         * Advertises the TopicPublisher using the TopicPublisherSystem provided
+         * by the "to" middleware's SystemHandle, unless it already did it
+         * the last time that the topic was configured.
+         */
+        Advertisement wanted = advertisement(info_map, topic_name, topic_config, to);
+        Advertisement previous;
+        if (runtime.find_advertisement(route, to, previous))
+        {
+            if (!previous.same_as(wanted))
             {
                 logger << utils::Logger::Level::ERROR
-                       << "Unrecognized system '" << mw_name << "' requested for remapping service "
-                       << "'" << service_name << "'" << std::endl;
-                return false;
+                       << "[" << to << " SystemHandle] Already publishes the topic '" << topic_name
+                       << "' as '" << previous.topic << "' with type '" << previous.type_name
+                       << "', which cannot be changed while running." << std::endl;
+
+                valid = false;
+                continue;
             }
-            _m_required_types[mw_name].services.insert(service_info.type);
-            if (!service_info.reply_type.empty())
+
+            wanted.publisher = previous.publisher;
+            logger << utils::Logger::Level::DEBUG
+                   << "[" << to << " SystemHandle] Reusing its publisher for the topic '"
+                   << topic_name << "'." << std::endl;
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(it_to->second.spin_mutex);
+            wanted.publisher = it_to->second.topic_publisher->advertise(
+                wanted.topic, *wanted.type, config_or_empty_node(to, topic_config.middleware_configs));
+            lock.unlock();
+
+            if (wanted.publisher)
             {
-                _m_required_types[mw_name].services.insert(service_info.reply_type);
+                runtime.add_advertisement(route, to, wanted);
             }
         }
+
+        const std::shared_ptr<TopicPublisher> publisher = wanted.publisher;
+
+        if (!publisher)
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "The system '" << to << "' failed to produce a publisher "
+                   << "for the topic '" << topic_name << "' and message type '"
+                   << topic_config.message_type << "'." << std::endl;
+
+            valid = false;
+        }
+        else
+        {
+            logger << utils::Logger::Level::INFO
+                   << "[" << to << " SystemHandle] Produced a publisher "
+                   << "for the topic '" << topic_name << "', with message type '"
+                   << topic_config.message_type << "'." << std::endl;
+
+            publishers.emplace_back(PublisherData(to, publisher, *pub_type));
+        }
     }
 
     /**
-     * Checks for defined but unused middlewares. Also, checks that at least two are being used.
+     * If the topic is configured `on_demand`, its sources are only subscribed
+     * while some of these publishers has matched subscribers.
      */
-    std::size_t active_mw_count = 0;
-    for (const auto& [mw_name, mw_config] : _m_middlewares)
+    std::shared_ptr<TopicDemand> demand = nullptr;
+    if (topic_config.on_demand)
     {
-        const auto it = _m_required_types.find(mw_name);
-        if (it == _m_required_types.end())
+        demand = std::make_shared<TopicDemand>(
+            topic_name, std::shared_ptr<std::atomic_bool>(gate, &gate->open), runtime.timers);
+        for (const PublisherData& pub : publishers)
+        {
+            demand->add_publisher(*pub.publisher);
+        }
+    }
+
+    /**
+     * For each `from` attribute in the route, the corresponding SystemHandle
+     * must produce a subscriber that fetches the data from the user's source
+     * application and convert it to the common language representation, that is,
+     * `eprosima::xtypes::DynamicData`.
+     * Then, this subscriber callback will take care of publishing the data
+     * in each one of the TopicPublishers defined in the `to` middleware list.
+     */
+    for (const std::string& from : topic_config.route.from)
+    {
+        /**
+         * First, it checks the subscribing capabilities of the middleware's SystemHandle.
+         */
+        const auto it_from = info_map.find(from);
+        if (it_from == info_map.end() || !it_from->second.topic_subscriber)
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not find topic subscribing capabilities for system "
+                   << "named '" << from << "', requested for topic '"
+                   << topic_name << "'." << std::endl;
+            valid = false;
+            continue;
+        }
+
+        /**
+         * Does remapping and type resolution, if applicable.
+         */
+        TopicInfo topic_info = remap_if_needed(
+            from, topic_config.remap, TopicInfo(topic_name, topic_config.message_type));
+
+        const eprosima::xtypes::DynamicType* sub_type = resolve_type(
+            it_from->second.types, topic_info.type);
+
+        /**
+         * Helper struct to store an Integration Service publisher
+         * and its published DynamicType. It is very similar to PublisherData,
+         * but includes the type consistency parameter between a certain publisher type
+         * and the current subscriber type.
+         */
+        struct Publication
+        {
+            Publication(
+                    const PublisherData& publisher_data,
+                    const eprosima::xtypes::DynamicType& sub_type)
+                : system(publisher_data.system)
+                , publisher(publisher_data.publisher)
+                , type(publisher_data.type)
+                , consistency(publisher_data.type.is_compatible(sub_type))
+            {
+            }
+
+            std::string system;
+            std::shared_ptr<TopicPublisher> publisher;
+            const eprosima::xtypes::DynamicType& type;
+            eprosima::xtypes::TypeConsistency consistency;
+        };
+
+        auto publications = std::make_shared<std::vector<Publication> >();
+        publications->reserve(publishers.size());
+
+        for (const auto& pub : publishers)
+        {
+            publications->emplace_back(Publication(pub, *sub_type));
+        }
+
+        /**
+         * Publishes a message over all the publishers created from the `to` field.
+         */
+        const auto forward = [publications, metrics, tracer, route](
+            const eprosima::xtypes::DynamicData& message,
+            uint64_t trace)
+                {
+                    using Clock = std::chrono::steady_clock;
+
+                    for (const Publication& publication : *publications)
+                    {
+                        const Clock::time_point start = Clock::now();
+                        Clock::time_point converted = start;
+                        if (publication.consistency == eprosima::xtypes::TypeConsistency::EQUALS)
+                        {
+                            publication.publisher->publish(message);
+                        }
+                        else
+                        {
+                            /**
+                             * Previously ensured that TypeConsistency is not NONE,
+                             * thanks to `check_topic_compatibility`.
+                             */
+                            eprosima::xtypes::DynamicData compatible_message = [&]()
+                                    {
+                                        const utils::Profiler::Scope profile(
+                                            "conversion", message.type().name(), publication.type.name());
+                                        return eprosima::xtypes::DynamicData(message, publication.type);
+                                    } ();
+                            converted = Clock::now();
+                            metrics->conversion().record(converted - start);
+
+                            publication.publisher->publish(compatible_message);
+                        }
+
+                        const Clock::time_point published = Clock::now();
+                        metrics->publish().record(published - converted);
+
+                        if (converted != start)
+                        {
+                            IS_TRACEPOINT(convert, route.c_str(), publication.system.c_str(),
+                                to_nanoseconds(converted - start));
+                        }
+                        IS_TRACEPOINT(publish, route.c_str(), publication.system.c_str(),
+                            to_nanoseconds(published - converted));
+
+                        if (trace)
+                        {
+                            if (converted != start)
+                            {
+                                tracer->record(trace, "convert", route, publication.system, start, converted);
+                            }
+                            tracer->record(trace, "publish", route, publication.system, converted, published);
+                        }
+                    }
+                };
+
+        /**
+         * In the sharded mode, the messages of the topic are always forwarded by the same shard.
+         */
+        ShardExecutor* const shards = runtime.shards.get();
+        const std::size_t shard = shards ? shards->shard_of(route) : 0;
+
+        /**
+         * Defines the Integration Service SubscriptionCallback lambda that will
+         * publish the data received through this subscriber over the publishers,
+         * either right away or handing it over to the shard of the topic.
+         * This is the core of the `from/to` route communication process.
+         */
+
+        std::unique_ptr<TopicSubscriberSystem::SubscriptionCallback> unique_callback = nullptr;
+        TopicSubscriberSystem* topic_subscriber_system = it_from->second.topic_subscriber;
+
+        unique_callback.reset(new TopicSubscriberSystem::SubscriptionCallback(
+                    [=](const eprosima::xtypes::DynamicData& message,
+                    void* filter_handle)
+                    {
+                        const InFlightGuard in_flight(*gate);
+                        const utils::MemoryTracker::Scope memory(account);
+                        if (!gate->accepts() || (demand && !demand->active()))
+                        {
+                            metrics->dropped();
+                            return;
+                        }
+
+                        if (topic_subscriber_system->is_internal_message(filter_handle))
+                        {
+                            return;
+                        }
+
+                        metrics->message();
+                        IS_TRACEPOINT(route_entry, route.c_str(), from.c_str());
+
+                        const uint64_t trace = tracer ? tracer->sample() : 0;
+                        const Tracer::Clock::time_point received = trace ? Tracer::Clock::now()
+                                                                   : Tracer::Clock::time_point();
+
+                        if (!shards)
+                        {
+                            forward(message, trace);
+                            if (trace)
+                            {
+                                tracer->record(trace, "receive", route, from, received, Tracer::Clock::now());
+                            }
+                            IS_TRACEPOINT(route_exit, route.c_str(), from.c_str());
+                            return;
+                        }
+
+                        /**
+                         * The message only lives during this call, so the shard gets a copy of it,
+                         * which is accounted for in the gate until it has been forwarded.
+                         * When traced, the receive span covers the time spent waiting in the shard.
+                         */
+                        auto copy = std::make_shared<eprosima::xtypes::DynamicData>(message);
+                        gate->in_flight.fetch_add(1);
+                        if (!shards->post(shard, [gate, forward, copy, trace, received, tracer, route, from, account]()
+                        {
+                            const utils::MemoryTracker::Scope task_memory(account);
+                            if (trace)
+                            {
+                                tracer->record(trace, "receive", route, from, received, Tracer::Clock::now());
+                            }
+                            forward(*copy, trace);
+                            gate->in_flight.fetch_sub(1);
+                        }))
+                        {
+                            gate->in_flight.fetch_sub(1);
+                            metrics->dropped();
+                        }
+                        IS_TRACEPOINT(route_exit, route.c_str(), from.c_str());
+                    }));
+
+        const eprosima::xtypes::DynamicType& message_type =
+                (topic_info.type.find(".") == std::string::npos
+                ? *sub_type
+                : *_m_types.at(topic_info.type.substr(0, topic_info.type.find("."))));
+
+        if (demand)
+        {
+            /**
+             * The subscription is left to the TopicDemand, which makes it whenever there is demand.
+             */
+            TopicSubscriberSystem::SubscriptionCallback* callback = unique_callback.get();
+            const std::string subscribed_topic = topic_info.name;
+            const YAML::Node middleware_config = config_or_empty_node(from, topic_config.middleware_configs);
+            std::mutex* const spin_mutex = &it_from->second.spin_mutex;
+
+            demand->add_source([=, &message_type](bool subscribe) -> bool
+                    {
+                        std::unique_lock<std::mutex> lock(*spin_mutex);
+                        return subscribe
+                        ? topic_subscriber_system->subscribe(
+                            subscribed_topic, message_type, callback, middleware_config)
+                        : topic_subscriber_system->unsubscribe(subscribed_topic);
+                    });
+
+            subscription_callbacks.emplace_back(std::move(unique_callback));
+
+            logger << utils::Logger::Level::INFO
+                   << "[" << from << " SystemHandle] Will subscribe on demand "
+                   << "to topic '" << topic_name << "', with message type '"
+                   << topic_config.message_type << "'." << std::endl;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(it_from->second.spin_mutex);
+        bool subscribed = it_from->second.topic_subscriber->subscribe(
+            topic_info.name,
+            message_type,
+            unique_callback.get(),
+            config_or_empty_node(from, topic_config.middleware_configs));
+        lock.unlock();
+
+        subscription_callbacks.emplace_back(std::move(unique_callback));
+
+        if (subscribed)
         {
-            logger << utils::Logger::Level::WARN
-                   << "The middleware '" << mw_name << "' of type '"
-                   << mw_config.type << "' is not being used in any topics "
-                   << "or services" << std::endl;
+            logger << utils::Logger::Level::INFO
+                   << "[" << from << " SystemHandle] Subscribed "
+                   << "to topic '" << topic_name << "', with message type '"
+                   << topic_config.message_type << "'." << std::endl;
         }
         else
         {
-            ++active_mw_count;
+            logger << utils::Logger::Level::ERROR
+                   << "[" << from << " SystemHandle] Failed to subscribe "
+                   << "to topic '" << topic_name << "', with message type '"
+                   << topic_config.message_type << "'." << std::endl;
         }
+
+        valid &= subscribed;
     }
 
-    if (active_mw_count < 2)
+    if (demand)
     {
-        logger << utils::Logger::Level::ERROR
-               << "Fewer than 2 middlewares (" << active_mw_count << ") are "
-               << "being used in this current configuration! This means that "
-               << "running Integration Service will not be useful." << std::endl;
-        return false;
+        runtime.set_demand(route, demand);
+        valid &= demand->start();
     }
 
-    _okay = true;
-    return true;
+    return valid;
 }
 
 //==============================================================================
-bool Config::okay() const
+bool Config::configure_services(
+        const is::internal::SystemHandleInfoMap& info_map,
+        RequestCallbacks& request_callbacks,
+        RuntimeContext& runtime) const
 {
-    return _okay;
-}
+    bool valid = true;
 
-//==============================================================================
-Config::operator bool() const
-{
-    return _okay;
+    /**
+     * Iterates through the services section of the provided configuration.
+     */
+    for (const auto& service : _m_service_configs)
+    {
+        valid &= configure_service(info_map, service.first, request_callbacks, runtime);
+    }
+
+    return valid;
 }
 
 //==============================================================================
-bool Config::load_middlewares(
-        is::internal::SystemHandleInfoMap& info_map) const
+bool Config::configure_service(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const std::string& service_name,
+        RequestCallbacks& request_callbacks,
+        RuntimeContext& runtime) const
 {
+    const auto it_service = _m_service_configs.find(service_name);
+    if (it_service == _m_service_configs.end())
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Trying to configure the service '" << service_name
+               << "', which is not part of the configuration." << std::endl;
+        return false;
+    }
+
+    const ServiceConfig& service_config = it_service->second;
+    bool valid = true;
+
     /**
-     * Sorts middlewares according to their dependencies in the `types-from` department.
-     * Middlewares specified in a `types-from` tag must be configured first.
+     * First, it checks service compatibility in terms of the registered types
+     * in the source and destination endpoints, both for request and reply types.
      */
-    using Entry = std::map<std::string, MiddlewareConfig>::value_type;
+    if (!check_service_compatibility(info_map, service_name, service_config))
+    {
+        return false;
+    }
 
-    std::list<Entry> middlewares(_m_middlewares.begin(), _m_middlewares.end());
+    const std::string& server = service_config.route.server;
+    const auto it_server = info_map.find(server);
 
-    middlewares.sort(
-        [](const Entry& a, const Entry& b) -> bool
-        {
-            auto& from = b.second.types_from;
-            return std::find(from.begin(), from.end(), a.first) != from.end();
-        });
+    if (it_server == info_map.end() || !it_server->second.service_provider)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Could not find service providing capabilities for system "
+               << "named '" << server << "', requested for service '"
+               << service_name << "'." << std::endl;
+
+        return false;
+    }
 
     /**
-     * Iterates through the sorted middlewares list, to load them in the appropriate order.
+     * Does remapping and type resolution, if applicable.
      */
-    for (const auto& [mw_name, mw_config] : middlewares)
-    {
-        const auto& ref_mw_name = mw_name;
-        const std::string& middleware_type = mw_config.type;
+    ServiceInfo server_info = remap_if_needed(
+        server, service_config.remap,
+        ServiceInfo(service_name, service_config.request_type, service_config.reply_type));
+
+    const eprosima::xtypes::DynamicType* server_type = resolve_type(
+        it_server->second.types, server_info.type);
 
+    /**
+     * Creates the ServiceProvider instance, differenciating the case of the service having a reply type, or not.
+     */
+    std::shared_ptr<ServiceProvider> provider = nullptr;
+    const eprosima::xtypes::DynamicType* server_reply_type = nullptr;
+    std::unique_lock<std::mutex> server_lock(it_server->second.spin_mutex);
+
+    if (!service_config.reply_type.empty())
+    {
+        server_reply_type =
+                (server_info.reply_type.find(".") == std::string::npos
+                ? resolve_type(it_server->second.types, server_info.reply_type)
+                : _m_types.at(server_info.reply_type.substr(0, server_info.reply_type.find("."))).get());
+
+        provider =
+                it_server->second.service_provider->create_service_proxy(
+            server_info.name,
+            (server_info.type.find(".") == std::string::npos
+            ? *server_type
+            : *_m_types.at(server_info.type.substr(0, server_info.type.find(".")))),
+            *server_reply_type,
+            config_or_empty_node(server, service_config.middleware_configs));
+    }
+    else
+    {
         logger << utils::Logger::Level::DEBUG
-               << "Config::load_middlewares: looking for middleware '" << mw_name
-               << "' with type '" << middleware_type << "'" << std::endl;
+               << "[" << server << " SystemHandle] The requested service server for the service '"
+               << service_name << "' does not have a reply type" << std::endl;
+
+        provider =
+                it_server->second.service_provider->create_service_proxy(
+            server_info.name,
+            (server_info.type.find(".") == std::string::npos
+            ? *server_type
+            : *_m_types.at(server_info.type.substr(0, server_info.type.find(".")))),
+            config_or_empty_node(server, service_config.middleware_configs));
+    }
+    server_lock.unlock();
 
-        const Search search(mw_config.type);
+    if (!provider)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "The system '" << server << "' failed to create a service provider "
+               << "for the service '" << service_name << "', with request type '"
+               << service_config.request_type << "'";
 
-        /**
-         * Looks for the middleware's SystemHandle dynamic library.
-         */
-        std::vector<std::string> checked_paths;
-        const std::string path = search.find_middleware_mix(&checked_paths);
+        if (!service_config.reply_type.empty())
+        {
+            logger << " and reply type '" << service_config.reply_type << "'";
+        }
+        logger << "." << std::endl;
+
+        return false;
+    }
+    else
+    {
+        logger << utils::Logger::Level::INFO
+               << " [" << server << " SystemHandle] Produced a service provider "
+               << "for the service '" << service_name << "', with request type '"
+               << service_config.request_type << "'";
 
-        if (path.empty())
+        if (!service_config.reply_type.empty())
         {
-            logger << utils::Logger::Level::ERROR
-                   << "Unable to find .mix file for middleware '" << middleware_type << "'. "
-                   << "The following locations were checked unsuccessfully: \n";
+            logger << " and reply type '" << service_config.reply_type << "'";
+        }
+        logger << "." << std::endl;
+    }
 
-            for (const std::string& checked_path : checked_paths)
-            {
-                logger << "\n\t- " << checked_path;
-            }
+    /**
+     * Every callback of the service shares the same gate, so that the whole route
+     * can be disabled at once if the service gets removed while reloading.
+     */
+    const std::string route = RuntimeContext::service_route(service_name);
+    const RuntimeContext::RouteGate gate = runtime.open_route(route);
+    const std::shared_ptr<RouteMetrics> metrics = runtime.route_metrics(route);
+    Tracer* const tracer = runtime.tracer.get();
+    utils::MemoryTracker::Account* const account = utils::MemoryTracker::account(route);
 
-            logger << "\nTry adding your middleware's install path to IS_PREFIX_PATH "
-                   << "or IS_" << Search::to_env_format(middleware_type) << "_PREFIX_PATH "
-                   << "environment variables." << std::endl;
+    /**
+     * The calls waiting for their response are accounted for in the gate, so that
+     * a draining instance can wait for them.
+     */
+    const auto tracker = std::make_shared<ServiceCallTracker>(
+        std::shared_ptr<std::atomic<int64_t> >(gate, &gate->in_flight));
 
-            return false;
-        }
+    /**
+     * If requested, the requests for this service will be hedged. The same ServiceHedging
+     * instance is shared by all the clients, since latencies depend on the server.
+     */
+    std::shared_ptr<ServiceHedging> hedging = nullptr;
+    if (service_config.hedging)
+    {
+        hedging = std::make_shared<ServiceHedging>(
+            service_name, *service_config.hedging, runtime.timers);
 
-        if (!Mix::from_file(path).load())
+        logger << utils::Logger::Level::INFO
+               << "[" << server << " SystemHandle] Requests for the service '"
+               << service_name << "' will be hedged after the p"
+               << service_config.hedging->percentile << " latency." << std::endl;
+    }
+
+    /**
+     * If requested, the requests for this service received within a short window will be
+     * sent together. The same ServiceBatcher instance is shared by all the clients.
+     */
+    std::shared_ptr<ServiceBatcher> batcher = nullptr;
+    if (service_config.batching)
+    {
+        batcher = std::make_shared<ServiceBatcher>(
+            service_name, *service_config.batching, provider, runtime.timers);
+
+        logger << utils::Logger::Level::INFO
+               << "[" << server << " SystemHandle] Requests for the service '"
+               << service_name << "' will be sent in batches of up to "
+               << service_config.batching->max_size << " requests." << std::endl;
+
+        std::weak_ptr<ServiceBatcher> weak_batcher = batcher;
+        runtime.add_flusher([weak_batcher]()
+                {
+                    if (auto pending = weak_batcher.lock())
+                    {
+                        pending->flush();
+                    }
+                });
+    }
+
+    /**
+     * Defines the Integration Service RequestCallback lambda that will
+     * be called each time the user client application makes a request.
+     *
+     * The specific middleware's SystemHandle implementation of the ServiceClient proxy
+     * should internally create a "server" of the specific middleware, to receive the
+     * request from the user application. This service uses the RequestCallback lambda to
+     * use the ServiceProvider created before, each time a request comes from the user (which
+     * defines a destination middleware client internally) to actually call the service
+     * on the user server application.
+     *
+     * The `call service` method signature passes as input argument a reference to the
+     * ServiceClient that made the request, which will call `receive_response` to send
+     * the response back to the user's client application.
+     */
+    for (const std::string& client : service_config.route.clients)
+    {
+        /**
+         * First, it checks the middleware's SystemHandle capabilities for creating service clients.
+         */
+        const auto it_client = info_map.find(client);
+        if (it_client == info_map.end() || !it_client->second.service_client)
         {
             logger << utils::Logger::Level::ERROR
-                   << "Unable to load the dynamic libraries present in the .mix file '"
-                   << path << "'." << std::endl;
+                   << "Could not find service client capabilities for system "
+                   << "named '" << client << "', requested for service '"
+                   << service_name << "'." << std::endl;
 
-            return false;
+            valid = false;
+            continue;
         }
 
         /**
-         * After loading the mix file, the middleware's SystemHandle library should be
-         * loaded, and it should be possible to find the middleware info in the
-         * internal Register.
+         * Does remapping and type resolution, if applicable.
          */
-        is::internal::SystemHandleInfo info = is::internal::Register::get(middleware_type);
+        ServiceInfo client_info = remap_if_needed(
+            client, service_config.remap,
+            ServiceInfo(service_name, service_config.request_type, service_config.reply_type));
 
-        if (!info || !info.handle->preprocess_types(mw_config.types_node))
+        const eprosima::xtypes::DynamicType* client_type = resolve_type(
+            it_client->second.types, client_info.type);
+
+        const eprosima::xtypes::DynamicType& client_request_type =
+                (client_info.type.find(".") == std::string::npos
+                ? *client_type
+                : *_m_types.at(client_info.type.substr(0, client_info.type.find("."))));
+
+        const eprosima::xtypes::DynamicType* client_reply_type = nullptr;
+        if (!client_info.reply_type.empty())
         {
-            return false;
+            client_reply_type =
+                    (client_info.reply_type.find(".") == std::string::npos
+                    ? resolve_type(it_client->second.types, client_info.reply_type)
+                    : _m_types.at(client_info.reply_type.substr(0, client_info.reply_type.find("."))).get());
         }
 
         /**
-         * Now, it iterates the middleware required types map.
-         * For each middleware, it checks which types it needs, and places them into
-         * the SystemHandleInfo structure.
+         * If the reply types of the client and the server are compatible, but not equal,
+         * the responses are converted by the core before reaching the client, the same
+         * way it is done for the requests. The target type is resolved only once, here.
          */
-        const auto requirements = _m_required_types.find(mw_name);
-
-        if (requirements != _m_required_types.end())
+        std::shared_ptr<ServiceReplyConversion> reply_conversion = nullptr;
+        if (client_reply_type && server_reply_type &&
+                client_reply_type->is_compatible(*server_reply_type) != eprosima::xtypes::TypeConsistency::EQUALS)
         {
-            /**
-             * Adds topics message types into the type registry, avoiding to insert duplicates.
-             */
-            for (const std::string& required_type : requirements->second.messages)
-            {
-                auto type_it = _m_types.find(required_type);
-
-                if (type_it != _m_types.end())
-                {
-                    info.types.emplace(*type_it);
-                }
-            }
-
-            /**
-             * Adds service types into the type registry, avoiding to insert duplicates.
-             */
-            for (const std::string& required_type : requirements->second.services)
-            {
-                auto type_it = _m_types.find(required_type);
+            reply_conversion = std::make_shared<ServiceReplyConversion>(*client_reply_type);
 
-                if (type_it != _m_types.end())
-                {
-                    info.types.emplace(*type_it);
-                }
-            }
+            logger << utils::Logger::Level::DEBUG
+                   << "[" << client << " SystemHandle] Responses for the service '" << service_name
+                   << "' will be converted from type '" << server_reply_type->name()
+                   << "' to type '" << client_reply_type->name() << "'." << std::endl;
+        }
 
-            /**
-             * Checks here the `types-from` attribute for this middleware.
-             * If it exists, it will contain a list of the middlewares it wants to
-             * import the types from.
-             *
-             * Check that this middleware already exists in the
-             * is::internal::SystemHandleInfoMap, and iterate over its types to copy them into the
-             * target middleware, that is, `mw_name`.
-             */
-            if (!mw_config.types_from.empty())
-            {
-                for (const std::string& mw_from : mw_config.types_from)
-                {
-                    const auto it = info_map.find(mw_from);
-                    if (it == info_map.end())
+        /**
+         * Defines the RequestCallback that will perform the corresponding call to the service.
+         */
+        eprosima::xtypes::TypeConsistency consistency = client_type->is_compatible(*server_type);
+
+        std::unique_ptr<ServiceClientSystem::RequestCallback> unique_callback = nullptr;
+        unique_callback.reset(new ServiceClientSystem::RequestCallback(
+                    [=](
+                        const eprosima::xtypes::DynamicData& request,
+                        ServiceClient& service_client,
+                        const std::shared_ptr<void>& call_handle)
                     {
-                        logger << utils::Logger::Level::ERROR
-                               << "'types-from' references to a non-existent middleware: '"
-                               << mw_from << "'. Maybe it has not been registered yet?"
-                               << std::endl;
-
-                        return false;
-                    }
+                        const InFlightGuard in_flight(*gate);
+                        const utils::MemoryTracker::Scope memory(account);
+                        if (!gate->accepts())
+                        {
+                            metrics->dropped();
+                            return;
+                        }
+
+                        metrics->message();
+                        IS_TRACEPOINT(route_entry, route.c_str(), client.c_str());
+
+                        using Clock = std::chrono::steady_clock;
+                        const Clock::time_point start = Clock::now();
+
+                        /**
+                         * A traced call gets its reply span once the response reaches the client.
+                         */
+                        const uint64_t trace = tracer ? tracer->sample() : 0;
+                        std::function<void()> on_response = nullptr;
+                        if (trace)
+                        {
+                            on_response = [tracer, trace, route, server, start]()
+                                    {
+                                        tracer->record(trace, "reply", route, server, start, Clock::now());
+                                    };
+                        }
+
+                        ServiceClient& reply_client = *tracker;
+                        const std::shared_ptr<void> reply_handle = reply_conversion
+                        ? tracker->wrap(*reply_conversion, reply_conversion->wrap(service_client, call_handle),
+                                std::move(on_response))
+                        : tracker->wrap(service_client, call_handle, std::move(on_response));
+
+                        const auto call = [&](
+                            const eprosima::xtypes::DynamicData& server_request)
+                                {
+                                    IS_TRACEPOINT(service_call, route.c_str(), server.c_str(), reply_handle.get());
+
+                                    if (batcher)
+                                    {
+                                        batcher->call_service(server_request, reply_client, reply_handle);
+                                    }
+                                    else if (hedging)
+                                    {
+                                        hedging->call_service(provider, server_request, reply_client, reply_handle);
+                                    }
+                                    else
+                                    {
+                                        provider->call_service(server_request, reply_client, reply_handle);
+                                    }
+                                };
+
+                        const Clock::time_point requested = Clock::now();
+                        Clock::time_point converted = requested;
+
+                        if (consistency == eprosima::xtypes::TypeConsistency::EQUALS)
+                        {
+                            call(request);
+                        }
+                        else //previously ensured that TypeConsistency is not NONE
+                        {
+                            const eprosima::xtypes::DynamicData server_request = [&]()
+                                    {
+                                        const utils::Profiler::Scope profile(
+                                            "conversion", request.type().name(), server_type->name());
+                                        return eprosima::xtypes::DynamicData(request, *server_type);
+                                    } ();
+                            converted = Clock::now();
+                            metrics->conversion().record(converted - requested);
+
+                            call(server_request);
+                        }
+
+                        const Clock::time_point called = Clock::now();
+                        metrics->publish().record(called - converted);
+
+                        if (converted != requested)
+                        {
+                            IS_TRACEPOINT(convert, route.c_str(), server.c_str(), to_nanoseconds(converted - requested));
+                        }
+                        IS_TRACEPOINT(route_exit, route.c_str(), client.c_str());
 
-                    for (auto&& it_type : info_map.at(mw_from).types)
-                    {
-                        info.types.emplace(it_type.second->name(), it_type.second);
-                    }
-                }
+                        if (trace)
+                        {
+                            if (converted != requested)
+                            {
+                                tracer->record(trace, "convert", route, server, requested, converted);
+                            }
+                            tracer->record(trace, "call", route, server, converted, called);
+                            tracer->record(trace, "request", route, client, start, called);
+                        }
+                    }));
 
-                /**
-                 * Now that we have added types from the `types-from` tag, the
-                 * SystemHandleInfo struct for this middleware (mw_name) should be complete.
-                 *
-                 * Therefore, iterating through its required_types and checking that every
-                 * type exists in the SystemHandleInfo::TypeRegistry should be ok. Otherwise,
-                 * it warns and returns false.
-                 */
-                for (const std::string& required_type : requirements->second.messages)
-                {
-                    if (!info.types.count(required_type))
-                    {
-                        logger << utils::Logger::Level::ERROR
-                               << "The middleware '" << mw_name
-                               << "' must satisfy the required topic type '"
-                               << required_type << "', but it does not seem to be "
-                               << "available neither in its type registry or inherited "
-                               << "from its 'types-from' reference middlewares" 
-                               << info.types
-                               << std::endl;
+        /**
+         * Finally, creates the service client proxy, differentiating between the cases of
+         * having a request_type + a reply_type, or only an unique type defined for the service.
+         */
+        bool created_client_proxy;
+        std::unique_lock<std::mutex> client_lock(it_client->second.spin_mutex);
 
-                        return false;
-                    }
-                }
+        if (client_info.reply_type.empty())
+        {
+            logger << utils::Logger::Level::DEBUG
+                   << "[" << client << " SystemHandle] The requested service client for the service '"
+                   << service_name << "' does not have a reply type" << std::endl;
 
-                for (const std::string& required_type : requirements->second.services)
-                {
-                    if (!info.types.count(required_type))
-                    {
-                        logger << utils::Logger::Level::ERROR
-                               << "The middleware '" << mw_name
-                               << "' must satisfy the required service type '"
-                               << required_type << "', but it does not seem to be "
-                               << "available neither in its type registry or inherited "
-                               << "from its 'types-from' reference middlewares" << std::endl;
-
-                        return false;
-                    }
-                }
-            }
+            created_client_proxy = it_client->second.service_client->create_client_proxy(
+                client_info.name,
+                client_request_type,
+                unique_callback.get(),
+                config_or_empty_node(client, service_config.middleware_configs));
         }
         else
         {
-            // Check if another middleware relies on types builtin or dynamically loaded by the middleware but not
-            // explicit in the configuration file
-            if ( middlewares.end() ==
-                    std::find_if(middlewares.begin(), middlewares.end(), [&ref_mw_name](const Entry& mw)
-                    {
-                        auto& from = mw.second.types_from;
-                        return ref_mw_name != mw.first && std::find(from.begin(), from.end(), ref_mw_name) != from.end();
-                    }))
-            {
-                logger << utils::Logger::Level::ERROR
-                       << "The middleware '" << mw_name
-                       << "' has no types associated" << std::endl;
-                return false;
-            }
+            created_client_proxy = it_client->second.service_client->create_client_proxy(
+                client_info.name,
+                client_request_type,
+                *client_reply_type,
+                unique_callback.get(),
+                config_or_empty_node(client, service_config.middleware_configs));
         }
+        client_lock.unlock();
 
-        /**
-         * Finally, now that the SystemHandleInfo struct is filled with all its types, it
-         * calls to the SystemHandle::configure override function for the selected middleware.
-         */
-        if ( info.handle->configure(
-                    requirements->second, mw_config.config_node, info.types))
+        request_callbacks.emplace_back(std::move(unique_callback));
+
+        if (created_client_proxy)
         {
-            // If the middleware was correctly configured, it inserts it within the info_map.
-            info_map.insert(std::make_pair(mw_name, std::move(info)));
+            logger << utils::Logger::Level::INFO
+                   << "[" << client << " SystemHandle] Produced a service client "
+                   << "for the service '" << service_name << "', with request type '"
+                   << service_config.request_type << "'";
+
+            if (!service_config.reply_type.empty())
+            {
+                logger << " and reply type '" << service_config.reply_type << "'";
+            }
+            logger << "." << std::endl;
         }
         else
         {
             logger << utils::Logger::Level::ERROR
-                   << "The middleware '" << mw_name
-                   << "' configuration step failed" << std::endl;
-            return false;
+                   << "The system '" << client << "' failed to create a service client "
+                   << "for the service '" << service_name << "', with request type '"
+                   << service_config.request_type << "'";
+
+            if (!service_config.reply_type.empty())
+            {
+                logger << " and reply type '" << service_config.reply_type << "'";
+            }
+            logger << "." << std::endl;
         }
+
+        valid &= created_client_proxy;
     }
 
-    return true;
+    return valid;
 }
 
 //==============================================================================
-bool Config::configure_topics(
+bool Config::configure_probes(
         const is::internal::SystemHandleInfoMap& info_map,
-        SubscriptionCallbacks& subscription_callbacks) const
+        SubscriptionCallbacks& subscription_callbacks,
+        RuntimeContext& runtime) const
 {
     bool valid = true;
 
-    /**
-     * Iterates through the topics section of the provided configuration.
-     */
-    for (const auto& [topic_name, topic_config] : _m_topic_configs)
+    for (const auto& [name, probe_config] : _m_probes)
     {
-        /**
-         * First, it checks topic compatibility in terms of the registered types
-         * in the source and destination endpoints.
-         */
-        if (!check_topic_compatibility(info_map, topic_name, topic_config))
-        {
-            valid = false;
-            continue;
-        }
-
-        /**
-         * Helper struct to store an Integration Service publisher
-         * and its published DynamicType.
-         */
-        struct PublisherData
-        {
-            PublisherData(
-                    std::shared_ptr<TopicPublisher> m_publisher,
-                    const eprosima::xtypes::DynamicType& m_type)
-                : publisher(m_publisher)
-                , type(m_type)
-            {
-            }
-
-            std::shared_ptr<TopicPublisher> publisher;
-            const eprosima::xtypes::DynamicType& type;
-        };
-
-        std::vector<PublisherData> publishers;
-        publishers.reserve(topic_config.route.to.size());
-
-        for (const std::string& to : topic_config.route.to)
-        {
-            /**
-             * The `to` endpoint within the route tells the related system that
-             * its SystemHandle must produce a publisher, so that the final application
-             * can subscribe to it and receive the information as described in the route
-             * data flow. Therefore, this middleware must have publishing capabilities,
-             * that is, its SystemHandleInfo::TopicPublisherSystem pointer must not be NULL.
-             */
-            const auto it_to = info_map.find(to);
-            if (it_to == info_map.end() || !it_to->second.topic_publisher)
-            {
-                logger << utils::Logger::Level::ERROR
-                       << "Could not find topic publishing capabilities for system "
-                       << "named '" << to << "', requested for topic '"
-                       << topic_name << "'." << std::endl;
-
-                valid = false;
-                continue;
-            }
-
-            /**
-             * Does remapping and type resolution, if applicable.
-             */
-            TopicInfo topic_info = remap_if_needed(
-                to, topic_config.remap, TopicInfo(topic_name, topic_config.message_type));
-
-            const eprosima::xtypes::DynamicType* pub_type = resolve_type(
-                it_to->second.types, topic_info.type);
-
-            /**
-             * Advertises the TopicPublisher using the TopicPublisherSystem provided
-             * by the "to" middleware's SystemHandle.
-             */
-            std::shared_ptr<TopicPublisher> publisher =
-                    it_to->second.topic_publisher->advertise(topic_info.name,
-                            (topic_info.type.find(".") == std::string::npos
-                            ? *pub_type
-                            : *_m_types.at(topic_info.type.substr(0, topic_info.type.find(".")))),
-                            config_or_empty_node(to, topic_config.middleware_configs));
+        const eprosima::xtypes::DynamicType& type = *_m_types.at(LatencyProbe::TYPE_NAME);
+        const auto probe = std::make_shared<LatencyProbe>(name, type);
 
-            if (!publisher)
+        if (!probe_config.from.empty())
+        {
+            const auto it_from = info_map.find(probe_config.from);
+            std::shared_ptr<TopicPublisher> publisher = nullptr;
+            if (it_from != info_map.end() && it_from->second.topic_publisher)
+            {
+                publisher = it_from->second.topic_publisher->advertise(
+                    probe_config.topic, type, YAML::Node());
+            }
+
+            if (!publisher || !probe->start(publisher, probe_config.period, runtime.timers))
             {
                 logger << utils::Logger::Level::ERROR
-                       << "The system '" << to << "' failed to produce a publisher "
-                       << "for the topic '" << topic_name << "' and message type '"
-                       << topic_config.message_type << "'." << std::endl;
+                       << "[" << probe_config.from << " SystemHandle] Could not publish the probe '"
+                       << name << "' on topic '" << probe_config.topic << "'." << std::endl;
 
                 valid = false;
+                continue;
             }
-            else
-            {
-                logger << utils::Logger::Level::INFO
-                       << "[" << to << " SystemHandle] Produced a publisher "
-                       << "for the topic '" << topic_name << "', with message type '"
-                       << topic_config.message_type << "'." << std::endl;
 
-                publishers.emplace_back(PublisherData(publisher, *pub_type));
-            }
+            logger << utils::Logger::Level::INFO
+                   << "[" << probe_config.from << " SystemHandle] Sending the probe '" << name
+                   << "' on topic '" << probe_config.topic << "' every "
+                   << probe_config.period.count() << " ms." << std::endl;
         }
 
-        /**
-         * For each `from` attribute in the route, the corresponding SystemHandle
-         * must produce a subscriber that fetches the data from the user's source
-         * application and convert it to the common language representation, that is,
-         * `eprosima::xtypes::DynamicData`.
-         * Then, this subscriber callback will take care of publishing the data
-         * in each one of the TopicPublishers defined in the `to` middleware list.
-         */
-        for (const std::string& from : topic_config.route.from)
+        if (!probe_config.to.empty())
         {
             /**
-             * First, it checks the subscribing capabilities of the middleware's SystemHandle.
+             * The probe messages are measured even if the system considers them its own,
+             * since the bridge under test may well be published by this same instance.
              */
-            const auto it_from = info_map.find(from);
-            if (it_from == info_map.end() || !it_from->second.topic_subscriber)
+            std::unique_ptr<TopicSubscriberSystem::SubscriptionCallback> callback(
+                new TopicSubscriberSystem::SubscriptionCallback(
+                    [probe](const eprosima::xtypes::DynamicData& message, void* /*filter_handle*/)
+                    {
+                        probe->receive(message);
+                    }));
+
+            const auto it_to = info_map.find(probe_config.to);
+            const bool subscribed = it_to != info_map.end() && it_to->second.topic_subscriber
+                    && it_to->second.topic_subscriber->subscribe(
+                probe_config.topic, type, callback.get(), YAML::Node());
+
+            subscription_callbacks.emplace_back(std::move(callback));
+
+            if (!subscribed)
             {
                 logger << utils::Logger::Level::ERROR
-                       << "Could not find topic subscribing capabilities for system "
-                       << "named '" << from << "', requested for topic '"
-                       << topic_name << "'." << std::endl;
+                       << "[" << probe_config.to << " SystemHandle] Could not receive the probe '"
+                       << name << "' on topic '" << probe_config.topic << "'." << std::endl;
+
                 valid = false;
                 continue;
             }
 
-            /**
-             * Does remapping and type resolution, if applicable.
-             */
-            TopicInfo topic_info = remap_if_needed(
-                from, topic_config.remap, TopicInfo(topic_name, topic_config.message_type));
+            logger << utils::Logger::Level::INFO
+                   << "[" << probe_config.to << " SystemHandle] Measuring the probe '" << name
+                   << "' on topic '" << probe_config.topic << "'." << std::endl;
+        }
+
+        runtime.probes.push_back(probe);
+    }
 
-            const eprosima::xtypes::DynamicType* sub_type = resolve_type(
-                it_from->second.types, topic_info.type);
+    return valid;
+}
 
-            /**
-             * Helper struct to store an Integration Service publisher
-             * and its published DynamicType. It is very similar to PublisherData,
-             * but includes the type consistency parameter between a certain publisher type
-             * and the current subscriber type.
-             */
-            struct Publication
-            {
-                Publication(
-                        const PublisherData& publisher_data,
-                        const eprosima::xtypes::DynamicType& sub_type)
-                    : publisher(publisher_data.publisher)
-                    , type(publisher_data.type)
-                    , consistency(publisher_data.type.is_compatible(sub_type))
+//==============================================================================
+void Config::describe(
+        const is::internal::SystemHandleInfoMap& info_map,
+        Introspection& introspection) const
+{
+    /**
+     * Resolves the type of an endpoint the same way the routes do. Types that the system
+     * does not know, which would have prevented the route from being set up, are left unresolved.
+     */
+    const auto endpoint_type = [&](
+        const std::string& system,
+        const std::string& type_name) -> const eprosima::xtypes::DynamicType*
+            {
+                if (type_name.find(".") != std::string::npos)
                 {
+                    const auto it_type = _m_types.find(type_name.substr(0, type_name.find(".")));
+                    return it_type == _m_types.end() ? nullptr : it_type->second.get();
                 }
 
-                std::shared_ptr<TopicPublisher> publisher;
-                const eprosima::xtypes::DynamicType& type;
-                eprosima::xtypes::TypeConsistency consistency;
+                const auto it = info_map.find(system);
+                if (it == info_map.end() || it->second.types.count(type_name) == 0)
+                {
+                    return nullptr;
+                }
+                return resolve_type(it->second.types, type_name);
             };
 
-            std::vector<Publication> publications;
-            publications.reserve(publishers.size());
-
-            for (const auto& pub : publishers)
+    const auto consistency = [](
+        const eprosima::xtypes::DynamicType* to_type,
+        const eprosima::xtypes::DynamicType* from_type)
             {
-                publications.emplace_back(Publication(pub, *sub_type));
-            }
-
-            /**
-             * Defines the Integration Service SubscriptionCallback lambda that will
-             * iterate over all the publishers created from the `to` field and
-             * publish the data received through this subscriber over them.
-             * This is the core of the `from/to` route communication process.
-             */
+                return to_type && from_type
+                       ? to_type->is_compatible(*from_type)
+                       : eprosima::xtypes::TypeConsistency::NONE;
+            };
 
-            std::unique_ptr<TopicSubscriberSystem::SubscriptionCallback> unique_callback = nullptr;
-            TopicSubscriberSystem* topic_subscriber_system = it_from->second.topic_subscriber;
+    for (const auto& [mw_name, mw_config] : _m_middlewares)
+    {
+        if (info_map.count(mw_name) > 0)
+        {
+            introspection.systems[mw_name] = mw_config.type;
+        }
+    }
 
-            unique_callback.reset(new TopicSubscriberSystem::SubscriptionCallback(
-                        [=](const eprosima::xtypes::DynamicData& message,
-                        void* filter_handle)
-                        {
-                            if (topic_subscriber_system->is_internal_message(filter_handle))
-                            {
-                                return;
-                            }
+    for (const auto& [topic_name, topic_config] : _m_topic_configs)
+    {
+        Introspection::Route& route = introspection.topics[topic_name];
 
-                            for (const Publication& publication : publications)
-                            {
-                                if (publication.consistency == eprosima::xtypes::TypeConsistency::EQUALS)
-                                {
-                                    publication.publisher->publish(message);
-                                }
-                                else
-                                {
-                                    /**
-                                     * Previously ensured that TypeConsistency is not NONE,
-                                     * thanks to `check_topic_compatibility`.
-                                     */
-                                    eprosima::xtypes::DynamicData compatible_message(
-                                        message, publication.type);
-                                    publication.publisher->publish(compatible_message);
-                                }
-                            }
-                        }));
+        const auto endpoint = [&](const std::string& system)
+                {
+                    const TopicInfo info = remap_if_needed(
+                        system, topic_config.remap, TopicInfo(topic_name, topic_config.message_type));
+                    return Introspection::Endpoint{system, info.name, info.type, std::string()};
+                };
 
-            bool subscribed = it_from->second.topic_subscriber->subscribe(
-                topic_info.name,
-                (topic_info.type.find(".") == std::string::npos
-                ? *sub_type
-                : *_m_types.at(topic_info.type.substr(0, topic_info.type.find(".")))),
-                unique_callback.get(),
-                config_or_empty_node(from, topic_config.middleware_configs));
+        for (const std::string& from : topic_config.route.from)
+        {
+            route.sources.push_back(endpoint(from));
+        }
 
-            subscription_callbacks.emplace_back(std::move(unique_callback));
+        for (const std::string& to : topic_config.route.to)
+        {
+            route.destinations.push_back(endpoint(to));
+        }
 
-            if (subscribed)
-            {
-                logger << utils::Logger::Level::INFO
-                       << "[" << from << " SystemHandle] Subscribed "
-                       << "to topic '" << topic_name << "', with message type '"
-                       << topic_config.message_type << "'." << std::endl;
-            }
-            else
+        for (const Introspection::Endpoint& source : route.sources)
+        {
+            for (const Introspection::Endpoint& destination : route.destinations)
             {
-                logger << utils::Logger::Level::ERROR
-                       << "[" << from << " SystemHandle] Failed to subscribe "
-                       << "to topic '" << topic_name << "', with message type '"
-                       << topic_config.message_type << "'." << std::endl;
+                route.publications.push_back(Introspection::Publication{
+                            source.system, destination.system,
+                            consistency(endpoint_type(destination.system, destination.type),
+                            endpoint_type(source.system, source.type))});
             }
-
-            valid &= subscribed;
         }
     }
 
-    return valid;
+    for (const auto& [service_name, service_config] : _m_service_configs)
+    {
+        Introspection::Route& route = introspection.services[service_name];
+
+        const auto endpoint = [&](const std::string& system)
+                {
+                    const ServiceInfo info = remap_if_needed(
+                        system, service_config.remap,
+                        ServiceInfo(service_name, service_config.request_type, service_config.reply_type));
+                    return Introspection::Endpoint{system, info.name, info.type, info.reply_type};
+                };
+
+        const Introspection::Endpoint server = endpoint(service_config.route.server);
+        route.destinations.push_back(server);
+
+        for (const std::string& client : service_config.route.clients)
+        {
+            route.sources.push_back(endpoint(client));
+            route.publications.push_back(Introspection::Publication{
+                        client, server.system,
+                        consistency(endpoint_type(route.sources.back().system, route.sources.back().type),
+                        endpoint_type(server.system, server.type))});
+        }
+    }
 }
 
 //==============================================================================
-bool Config::configure_services(
+bool Config::check_changes(
         const is::internal::SystemHandleInfoMap& info_map,
-        RequestCallbacks& request_callbacks) const
+        const ConfigChanges& changes,
+        const RuntimeContext& runtime) const
 {
     bool valid = true;
 
-    /**
-     * Iterates through the services section of the provided configuration.
-     */
-    for (const auto& [service_name, service_config] : _m_service_configs)
+    for (const std::string& topic_name : changes.topics_added)
     {
-        /**
-         * First, it checks service compatibility in terms of the registered types
-         * in the source and destination endpoints, both for request and reply types.
-         */
-        if (!check_service_compatibility(info_map, service_name, service_config))
+        const TopicConfig& config = _m_topic_configs.at(topic_name);
+        if (!check_topic_compatibility(info_map, topic_name, config))
         {
             valid = false;
             continue;
         }
 
-        const std::string& server = service_config.route.server;
-        const auto it_server = info_map.find(server);
-
-        if (it_server == info_map.end() || !it_server->second.service_provider)
+        for (const std::string& to : config.route.to)
         {
-            logger << utils::Logger::Level::ERROR
-                   << "Could not find service providing capabilities for system "
-                   << "named '" << server << "', requested for service '"
-                   << service_name << "'." << std::endl;
-
-            valid = false;
-            continue;
+            Advertisement previous;
+            if (runtime.find_advertisement(RuntimeContext::topic_route(topic_name), to, previous)
+                    && !previous.same_as(advertisement(info_map, topic_name, config, to)))
+            {
+                logger << utils::Logger::Level::ERROR
+                       << "[" << to << " SystemHandle] Already publishes the topic '" << topic_name
+                       << "' as '" << previous.topic << "' with type '" << previous.type_name
+                       << "', which cannot be changed while running." << std::endl;
+                valid = false;
+            }
         }
+    }
 
-        /**
-         * Does remapping and type resolution, if applicable.
-         */
-        ServiceInfo server_info = remap_if_needed(
-            server, service_config.remap,
-            ServiceInfo(service_name, service_config.request_type, service_config.reply_type));
-
-        const eprosima::xtypes::DynamicType* server_type = resolve_type(
-            it_server->second.types, server_info.type);
+    for (const std::string& service_name : changes.services_added)
+    {
+        valid &= check_service_compatibility(info_map, service_name, _m_service_configs.at(service_name));
+    }
 
-        /**
-         * Creates the ServiceProvider instance, differenciating the case of the service having a reply type, or not.
-         */
-        std::shared_ptr<ServiceProvider> provider = nullptr;
+    return valid;
+}
 
-        if (!service_config.reply_type.empty())
-        {
-            const eprosima::xtypes::DynamicType* server_reply_type = resolve_type(
-                it_server->second.types, server_info.reply_type);
+//==============================================================================
+bool Config::check_tear_down(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const ConfigChanges& changes) const
+{
+    bool valid = true;
 
-            provider =
-                    it_server->second.service_provider->create_service_proxy(
-                server_info.name,
-                (server_info.type.find(".") == std::string::npos
-                ? *server_type
-                : *_m_types.at(server_info.type.substr(0, server_info.type.find(".")))),
-                (server_info.reply_type.find(".") == std::string::npos
-                ? *server_reply_type
-                : *_m_types.at(server_info.reply_type.substr(0, server_info.reply_type.find(".")))),
-                config_or_empty_node(server, service_config.middleware_configs));
-        }
-        else
+    for (const std::string& topic_name : changes.topics_removed)
+    {
+        const bool modified = std::find(
+            changes.topics_added.begin(), changes.topics_added.end(), topic_name) != changes.topics_added.end();
+        if (!modified)
         {
-            logger << utils::Logger::Level::DEBUG
-                   << "[" << server << " SystemHandle] The requested service server for the service '"
-                   << service_name << "' does not have a reply type" << std::endl;
-
-            provider =
-                    it_server->second.service_provider->create_service_proxy(
-                server_info.name,
-                (server_info.type.find(".") == std::string::npos
-                ? *server_type
-                : *_m_types.at(server_info.type.substr(0, server_info.type.find(".")))),
-                config_or_empty_node(server, service_config.middleware_configs));
+            continue;
         }
 
-        if (!provider)
-        {
-            logger << utils::Logger::Level::ERROR
-                   << "The system '" << server << "' failed to create a service provider "
-                   << "for the service '" << service_name << "', with request type '"
-                   << service_config.request_type << "'";
-
-            if (!service_config.reply_type.empty())
-            {
-                logger << " and reply type '" << service_config.reply_type << "'";
-            }
-            logger << "." << std::endl;
-
-            return false;
-        }
-        else
+        for (const std::string& from : _m_topic_configs.at(topic_name).route.from)
         {
-            logger << utils::Logger::Level::INFO
-                   << " [" << server << " SystemHandle] Produced a service provider "
-                   << "for the service '" << service_name << "', with request type '"
-                   << service_config.request_type << "'";
-
-            if (!service_config.reply_type.empty())
+            const auto it_from = info_map.find(from);
+            if (it_from != info_map.end() && it_from->second.topic_subscriber
+                    && !it_from->second.topic_subscriber->can_unsubscribe())
             {
-                logger << " and reply type '" << service_config.reply_type << "'";
+                logger << utils::Logger::Level::ERROR
+                       << "[" << from << " SystemHandle] Cannot unsubscribe from topic '" << topic_name
+                       << "', so the topic cannot be modified while running." << std::endl;
+                valid = false;
             }
-            logger << "." << std::endl;
         }
+    }
 
-        /**
-         * Defines the Integration Service RequestCallback lambda that will
-         * be called each time the user client application makes a request.
-         *
-         * The specific middleware's SystemHandle implementation of the ServiceClient proxy
-         * should internally create a "server" of the specific middleware, to receive the
-         * request from the user application. This service uses the RequestCallback lambda to
-         * use the ServiceProvider created before, each time a request comes from the user (which
-         * defines a destination middleware client internally) to actually call the service
-         * on the user server application.
-         *
-         * The `call service` method signature passes as input argument a reference to the
-         * ServiceClient that made the request, which will call `receive_response` to send
-         * the response back to the user's client application.
-         */
-        for (const std::string& client : service_config.route.clients)
+    for (const std::string& service_name : changes.services_removed)
+    {
+        for (const std::string& client : _m_service_configs.at(service_name).route.clients)
         {
-            /**
-             * First, it checks the middleware's SystemHandle capabilities for creating service clients.
-             */
             const auto it_client = info_map.find(client);
-            if (it_client == info_map.end() || !it_client->second.service_client)
+            if (it_client != info_map.end() && it_client->second.service_client
+                    && !it_client->second.service_client->can_remove_client_proxy())
             {
                 logger << utils::Logger::Level::ERROR
-                       << "Could not find service client capabilities for system "
-                       << "named '" << client << "', requested for service '"
-                       << service_name << "'." << std::endl;
-
+                       << "[" << client << " SystemHandle] Cannot remove the client proxy of service '"
+                       << service_name << "', so the service cannot be removed or modified while running."
+                       << std::endl;
                 valid = false;
-                continue;
             }
+        }
+    }
 
-            /**
-             * Does remapping and type resolution, if applicable.
-             */
-            ServiceInfo client_info = remap_if_needed(
-                client, service_config.remap,
-                ServiceInfo(service_name, service_config.request_type, service_config.reply_type));
+    return valid;
+}
 
-            const eprosima::xtypes::DynamicType* client_type = resolve_type(
-                it_client->second.types, client_info.type);
+//==============================================================================
+bool Config::tear_down_topic(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const std::string& topic_name,
+        RuntimeContext& runtime) const
+{
+    runtime.close_route(RuntimeContext::topic_route(topic_name));
 
-            /**
-             * Defines the RequestCallback that will perform the corresponding call to the service.
-             */
-            eprosima::xtypes::TypeConsistency consistency = client_type->is_compatible(*server_type);
-
-            std::unique_ptr<ServiceClientSystem::RequestCallback> unique_callback = nullptr;
-            unique_callback.reset(new ServiceClientSystem::RequestCallback(
-                        [=](
-                            const eprosima::xtypes::DynamicData& request,
-                            ServiceClient& service_client,
-                            const std::shared_ptr<void>& call_handle)
-                        {
-                            if (consistency == eprosima::xtypes::TypeConsistency::EQUALS)
-                            {
-                                provider->call_service(request, service_client, call_handle);
-                            }
-                            else //previously ensured that TypeConsistency is not NONE
-                            {
-                                eprosima::xtypes::DynamicData compatible_request(request, *server_type);
-                                provider->call_service(compatible_request, service_client, call_handle);
-                            }
-                        }));
+    const auto it_topic = _m_topic_configs.find(topic_name);
+    if (it_topic == _m_topic_configs.end())
+    {
+        return true;
+    }
 
-            /**
-             * Finally, creates the service client proxy, differentiating between the cases of
-             * having a request_type + a reply_type, or only an unique type defined for the service.
-             */
-            bool created_client_proxy;
+    /**
+     * The sources of an on-demand topic may already be unsubscribed, so they are left to its TopicDemand,
+     * which only asks each of them once.
+     */
+    if (const std::shared_ptr<TopicDemand> demand = runtime.take_demand(RuntimeContext::topic_route(topic_name)))
+    {
+        const bool detached = demand->stop();
+        logger << utils::Logger::Level::INFO
+               << "Removed topic '" << topic_name << "'." << std::endl;
+        return detached;
+    }
 
-            if (client_info.reply_type.empty())
-            {
-                logger << utils::Logger::Level::DEBUG
-                       << "[" << client << " SystemHandle] The requested service client for the service '"
-                       << service_name << "' does not have a reply type" << std::endl;
+    bool detached = true;
+    for (const std::string& from : it_topic->second.route.from)
+    {
+        const auto it_from = info_map.find(from);
+        if (it_from == info_map.end() || !it_from->second.topic_subscriber)
+        {
+            continue;
+        }
 
-                created_client_proxy = it_client->second.service_client->create_client_proxy(
-                    client_info.name,
-                    //*client_type,
-                    (client_info.type.find(".") == std::string::npos
-                    ? *client_type
-                    : *_m_types.at(client_info.type.substr(0, client_info.type.find(".")))),
-                    unique_callback.get(),
-                    config_or_empty_node(client, service_config.middleware_configs));
-            }
-            else
-            {
-                const eprosima::xtypes::DynamicType* client_reply_type = resolve_type(
-                    it_client->second.types, client_info.reply_type);
+        const TopicInfo topic_info = remap_if_needed(
+            from, it_topic->second.remap, TopicInfo(topic_name, it_topic->second.message_type));
 
-                created_client_proxy = it_client->second.service_client->create_client_proxy(
-                    client_info.name,
-                    //*client_type,
-                    (client_info.type.find(".") == std::string::npos
-                    ? *client_type
-                    : *_m_types.at(client_info.type.substr(0, client_info.type.find(".")))),
-                    (client_info.reply_type.find(".") == std::string::npos
-                    ? *client_reply_type
-                    : *_m_types.at(client_info.reply_type.substr(0, client_info.reply_type.find(".")))),
-                    unique_callback.get(),
-                    config_or_empty_node(client, service_config.middleware_configs));
-            }
+        std::unique_lock<std::mutex> lock(it_from->second.spin_mutex);
+        if (!it_from->second.topic_subscriber->unsubscribe(topic_info.name))
+        {
+            logger << utils::Logger::Level::DEBUG
+                   << "[" << from << " SystemHandle] Does not support unsubscribing from topic '"
+                   << topic_name << "'. Its messages will be discarded." << std::endl;
+            detached = false;
+        }
+    }
 
-            request_callbacks.emplace_back(std::move(unique_callback));
+    logger << utils::Logger::Level::INFO
+           << "Removed topic '" << topic_name << "'." << std::endl;
+    return detached;
+}
 
-            if (created_client_proxy)
-            {
-                logger << utils::Logger::Level::INFO
-                       << "[" << client << " SystemHandle] Produced a service client "
-                       << "for the service '" << service_name << "', with request type '"
-                       << service_config.request_type << "'";
+//==============================================================================
+bool Config::tear_down_service(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const std::string& service_name,
+        RuntimeContext& runtime) const
+{
+    runtime.close_route(RuntimeContext::service_route(service_name));
 
-                if (!service_config.reply_type.empty())
-                {
-                    logger << " and reply type '" << service_config.reply_type << "'";
-                }
-                logger << "." << std::endl;
-            }
-            else
-            {
-                logger << utils::Logger::Level::ERROR
-                       << "The system '" << client << "' failed to create a service client "
-                       << "for the service '" << service_name << "', with request type '"
-                       << service_config.request_type << "'";
+    const auto it_service = _m_service_configs.find(service_name);
+    if (it_service == _m_service_configs.end())
+    {
+        return true;
+    }
 
-                if (!service_config.reply_type.empty())
-                {
-                    logger << " and reply type '" << service_config.reply_type << "'";
-                }
-                logger << "." << std::endl;
-            }
+    bool detached = true;
+    for (const std::string& client : it_service->second.route.clients)
+    {
+        const auto it_client = info_map.find(client);
+        if (it_client == info_map.end() || !it_client->second.service_client)
+        {
+            continue;
+        }
+
+        const ServiceInfo service_info = remap_if_needed(
+            client, it_service->second.remap,
+            ServiceInfo(service_name, it_service->second.request_type, it_service->second.reply_type));
 
-            valid &= created_client_proxy;
+        std::unique_lock<std::mutex> lock(it_client->second.spin_mutex);
+        if (!it_client->second.service_client->remove_client_proxy(service_info.name))
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "[" << client << " SystemHandle] Could not remove the client proxy of service '"
+                   << service_name << "'. Its requests will not be answered." << std::endl;
+            detached = false;
         }
     }
 
-    return valid;
+    logger << utils::Logger::Level::INFO
+           << "Removed service '" << service_name << "'." << std::endl;
+    return detached;
 }
 
 //==============================================================================
@@ -1991,6 +3952,46 @@ bool Config::check_service_compatibility(
     return valid;
 }
 
+//==============================================================================
+Advertisement Config::advertisement(
+        const is::internal::SystemHandleInfoMap& info_map,
+        const std::string& topic_name,
+        const TopicConfig& config,
+        const std::string& to) const
+{
+    const TopicInfo topic_info = remap_if_needed(to, config.remap, TopicInfo(topic_name, config.message_type));
+
+    Advertisement advertisement;
+    advertisement.topic = topic_info.name;
+    advertisement.type_name = topic_info.type;
+    advertisement.configuration = YAML::Dump(config_or_empty_node(to, config.middleware_configs));
+
+    /**
+     * A member of a type is published with the whole type, which the configuration defines.
+     */
+    const std::size_t dot = topic_info.type.find(".");
+    if (dot != std::string::npos)
+    {
+        const auto it_type = _m_types.find(topic_info.type.substr(0, dot));
+        if (it_type != _m_types.end())
+        {
+            advertisement.type = it_type->second;
+        }
+    }
+    else
+    {
+        const TypeRegistry& types = info_map.at(to).types;
+        const auto it_type = types.find(topic_info.type);
+        if (it_type != types.end())
+        {
+            advertisement.type = it_type->second;
+        }
+    }
+
+    return advertisement;
+}
+
+//==============================================================================
 const xtypes::DynamicType* Config::resolve_type(
         const TypeRegistry& types,
         const std::string& path) const
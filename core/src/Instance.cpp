@@ -16,15 +16,29 @@
  *
  */
 #include <is/core/Instance.hpp>
+#include <is/core/runtime/Reactor.hpp>
+#include <is/core/runtime/MetricsServer.hpp>
+#include <is/core/runtime/Realtime.hpp>
+#include <is/core/runtime/SpinPolicy.hpp>
+#include <is/core/runtime/ThreadSettings.hpp>
+#include <is/utils/MemoryTracker.hpp>
+#include <is/utils/Profiler.hpp>
+#include <is/utils/Tracepoint.hpp>
 
 #include <yaml-cpp/yaml.h>
 
 #include <boost/program_options.hpp> // TODO (@jamoralp): get rid of this dependency.
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <iostream>
+#include <list>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <thread>
 
 #include <csignal>
@@ -45,6 +59,45 @@ extern "C" void interruption_handler(
     std::cout << std::endl << "\t[[ Ctrl+C detected: terminating Integration Service... ]]" << std::endl;
 }
 
+/**
+ * Number of SIGHUP signals received. Each reloadable instance compares it periodically
+ * with the last value it has seen, and reloads its config-file when it changes.
+ */
+static int reloadable_instances = 0;
+static std::atomic_uint reload_requests(0);
+
+extern "C" void reload_handler(
+        int)
+{
+    ++reload_requests;
+}
+
+/**
+ * Number of SIGTERM signals received, followed in the same way as the SIGHUP ones
+ * by the instances configured with a drain timeout.
+ */
+static int drainable_instances = 0;
+static std::atomic_uint drain_requests(0);
+
+extern "C" void drain_handler(
+        int)
+{
+    ++drain_requests;
+}
+
+/**
+ * Number of SIGUSR1 signals received, followed in the same way as the SIGHUP ones
+ * by the instances with the profiler enabled, which log its report.
+ */
+static int profiled_instances = 0;
+static std::atomic_uint profile_requests(0);
+
+extern "C" void profile_handler(
+        int)
+{
+    ++profile_requests;
+}
+
 //==============================================================================
 struct ArgumentStack
 {
@@ -61,12 +114,21 @@ public:
     friend class Instance;
 
     Implementation(
-            internal::Config configuration)
+            internal::Config configuration,
+            const std::string& config_file = "")
         : m_running(true)
         , _configuration(std::move(configuration))
+        , _running_configuration(&_configuration)
+        , _config_file(config_file)
+        , _reload_requests_seen(0)
+        , _drain_requests_seen(0)
+        , _profile_requests_seen(0)
+        , _draining(false)
+        , _embedded(false)
         , _quit(false)
         , _active_middlewares(0)
         , _return_code(0)
+        , _page_faults(0)
         , _logger("is::core::InstanceHandle")
     {
         if (!configure_integration_service())
@@ -82,13 +144,40 @@ public:
     Implementation(
             const int return_code)
         : m_running(false)
+        , _running_configuration(&_configuration)
+        , _reload_requests_seen(0)
+        , _drain_requests_seen(0)
+        , _profile_requests_seen(0)
+        , _draining(false)
+        , _embedded(false)
         , _quit(true)
         , _active_middlewares(0)
         , _return_code(return_code)
+        , _page_faults(0)
     {
     }
 
-    ~Implementation() = default;
+    ~Implementation()
+    {
+        /**
+         * The metrics server reads the state of the instance, so it is the first thing to go.
+         */
+        _metrics_server.reset();
+
+        if (_drain_thread.joinable() || _reload_thread.joinable() || _profile_thread.joinable()
+                || _watchdog_thread.joinable())
+        {
+            _quit = true;
+            wake_up_sleepers();
+        }
+
+        join_watchers();
+
+        /**
+         * Deferred route work must be stopped before the SystemHandles get destroyed.
+         */
+        _runtime.stop();
+    }
 
     bool configure_integration_service()
     {
@@ -99,149 +188,1466 @@ public:
             return false;
         }
 
-        if (!_configuration.configure_topics(_info_map, subscription_callbacks_))
+        for (const auto& [mw_name, systemhandle_info] : _info_map)
+        {
+            auto& stats = _system_stats[mw_name];
+            stats = std::make_unique<SystemStats>();
+            stats->memory = utils::MemoryTracker::account("system:" + mw_name);
+        }
+
+        /**
+         * In the sharded mode, the shards must be running before the topics get configured,
+         * so that their callbacks can hand the messages over to them.
+         */
+        const internal::ShardsConfig& shards = _configuration.executor().shards;
+        if (shards.count > 0)
+        {
+            std::vector<ThreadSettings> settings(shards.count);
+            for (std::size_t i = 0; i < shards.count; ++i)
+            {
+                settings[i].name = "is-shard-" + std::to_string(i);
+                if (i < shards.cpus.size())
+                {
+                    settings[i].cpus = {shards.cpus[i]};
+                }
+            }
+
+            _runtime.shards.reset(new ShardExecutor(settings, shards.queue_size));
+
+            _logger << utils::Logger::Level::INFO
+                    << "The topics will be forwarded by " << shards.count << " shards." << std::endl;
+        }
+
+        if (_configuration.profiler().enabled)
+        {
+            utils::Profiler::enable();
+
+            _logger << utils::Logger::Level::INFO
+                    << "Profiling the conversions"
+                    << (utils::Profiler::counts_allocations() ? ", along with their allocations." : ".")
+                    << std::endl;
+        }
+
+        const std::optional<Tracer::Policy>& tracing = _configuration.tracing();
+        if (tracing)
+        {
+            _runtime.tracer.reset(new Tracer(*tracing));
+
+            _logger << utils::Logger::Level::INFO
+                    << "Tracing " << tracing->sample_rate * 100 << "% of the messages into '"
+                    << tracing->file << "'." << std::endl;
+        }
+
+        if (!_configuration.configure_topics(_info_map, subscription_callbacks_, _runtime))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to configure topics!" << std::endl;
+            return false;
+        }
+
+        if (!_configuration.configure_services(_info_map, request_callbacks_, _runtime))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to configure services!" << std::endl;
+            return false;
+        }
+
+        if (!_configuration.configure_probes(_info_map, subscription_callbacks_, _runtime))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to configure probes!" << std::endl;
+            return false;
+        }
+
+        const internal::MetricsConfig& metrics = _configuration.metrics();
+        if (metrics.port)
+        {
+            _metrics_server.reset(new MetricsServer(metrics.address, *metrics.port, [this]()
+                    {
+                        return render_metrics();
+                    }));
+
+            if (!_metrics_server->start())
+            {
+                _logger << utils::Logger::Level::ERROR
+                        << "Failed to start the metrics endpoint!" << std::endl;
+                return false;
+            }
+        }
+
+        _logger << utils::Logger::Level::DEBUG
+                << "Integration Service instance successfully configured." << std::endl;
+        return true;
+    }
+
+    void run()
+    {
+        if (_quit)
+        {
+            m_running = false;
+            return;
+        }
+
+        /**
+         * It is pointless to run the *Integration Service* with less than two systems involved.
+         */
+        if (_info_map.size() < 2)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Attemtping to run an Integration Service instance without at least "
+                    << "two systems (you are using: " << _info_map.size()
+                    << "). An Integration Service instance with less than two systems is "
+                    << "useless, so we will quit soon." << std::endl;
+
+            _quit = true;
+            _return_code = 1;
+            return;
+        }
+
+        /**
+         * Increments the number of active instances.
+         */
+        {
+            std::unique_lock<std::mutex> lock(change_interruption_mutex);
+            signal(SIGINT, interruption_handler);
+            ++interruptable_instances;
+
+            /**
+             * Instances started from a config-file reload it when receiving SIGHUP.
+             */
+            if (!_config_file.empty())
+            {
+                signal(SIGHUP, reload_handler);
+                ++reloadable_instances;
+                _reload_requests_seen = reload_requests;
+                _reload_thread = std::thread([this]()
+                                {
+                                    watch_reload_requests();
+                                });
+            }
+
+            /**
+             * Instances with a drain timeout drain themselves when receiving SIGTERM.
+             */
+            if (_configuration.executor().drain_timeout.count() > 0)
+            {
+                signal(SIGTERM, drain_handler);
+                ++drainable_instances;
+                _drain_requests_seen = drain_requests;
+                _drain_thread = std::thread([this]()
+                                {
+                                    watch_drain_requests();
+                                });
+            }
+
+            /**
+             * Instances with the profiler enabled log its report when receiving SIGUSR1.
+             */
+            if (_configuration.profiler().enabled)
+            {
+                signal(SIGUSR1, profile_handler);
+                ++profiled_instances;
+                _profile_requests_seen = profile_requests;
+                _profile_thread = std::thread([this]()
+                                {
+                                    watch_profile_requests();
+                                });
+            }
+        }
+
+        start_stall_watchdog();
+
+        const internal::ExecutorConfig& executor = _configuration.executor();
+
+        /**
+         * In real-time mode, memory is locked and pre-faulted before any system starts spinning.
+         */
+        if (executor.realtime.enabled && !executor.realtime.apply_to_process())
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to enable the real-time mode, so we will quit soon." << std::endl;
+
+            _quit = true;
+            _return_code = 1;
+        }
+
+        _work_threads.reserve(_info_map.size() + 1);
+
+        /**
+         * Systems assigned to a thread in the executor configuration are spun by that thread, in turns.
+         */
+        std::set<std::string> assigned;
+        for (const internal::ExecutorThreadConfig& thread : executor.threads)
+        {
+            std::vector<SystemEntry> systems;
+            std::vector<int> wait_handles;
+            for (const std::string& system : thread.systems)
+            {
+                const auto it = _info_map.find(system);
+                if (it != _info_map.end())
+                {
+                    systems.emplace_back(&it->first, &it->second);
+                    assigned.insert(system);
+
+                    if (it->second.event_driven)
+                    {
+                        wait_handles.push_back(it->second.event_driven->wait_handle());
+                    }
+                    else if (thread.spin.kind == SpinPolicy::Kind::BLOCKING)
+                    {
+                        _logger << utils::Logger::Level::WARN
+                                << "The executor thread '" << thread.settings.name << "' uses the 'blocking' "
+                                << "spin policy, but the system '" << system << "' is not event driven: "
+                                << "its work may wait up to the 'block_timeout_us' to be served." << std::endl;
+                    }
+                }
+            }
+
+            if (systems.empty())
+            {
+                continue;
+            }
+
+            auto strategy = std::make_shared<SpinStrategy>(thread.spin, std::move(wait_handles));
+            launch_runner(thread.settings, [this, systems, strategy]()
+                    {
+                        bool worked = false;
+                        for (const auto& [mw_name, systemhandle_info] : systems)
+                        {
+                            worked |= (spin_system(*mw_name, *systemhandle_info) == SpinResult::WORK_DONE);
+                        }
+
+                        if (worked)
+                        {
+                            strategy->worked();
+                        }
+                        else
+                        {
+                            strategy->idle();
+                        }
+                    });
+        }
+
+        for (const auto& [mw_name, systemhandle_info] : _info_map)
+        {
+            if (assigned.count(mw_name))
+            {
+                continue;
+            }
+
+            const auto& ref_mw_name = mw_name;
+            const auto& ref_systemhandle_info = systemhandle_info;
+
+            /**
+             * Event driven systems are run by the reactor, which only spins them when they have work to do.
+             */
+            if (ref_systemhandle_info.event_driven
+                    && _reactor.add(
+                        ref_systemhandle_info.event_driven->wait_handle(),
+                        [this, &ref_mw_name, &ref_systemhandle_info]()
+                        {
+                            return spin_system(ref_mw_name, ref_systemhandle_info) != SpinResult::FAILURE;
+                        }))
+            {
+                _logger << utils::Logger::Level::DEBUG
+                        << "The SystemHandle of middleware named '" << ref_mw_name
+                        << "' will be run by the reactor." << std::endl;
+                continue;
+            }
+
+            /**
+             * For each other systemhandle, creates a working thread that will check that the
+             * SystemHandle instance is alive and calls spin_once() to execute pending work.
+             */
+            ThreadSettings settings = executor.default_settings;
+            settings.name = ref_mw_name;
+
+            const SpinPolicy spin = _configuration.spin_policy(ref_mw_name);
+            std::vector<int> wait_handles;
+            if (ref_systemhandle_info.event_driven)
+            {
+                wait_handles.push_back(ref_systemhandle_info.event_driven->wait_handle());
+            }
+            else if (spin.kind == SpinPolicy::Kind::BLOCKING)
+            {
+                _logger << utils::Logger::Level::WARN
+                        << "The system '" << ref_mw_name << "' uses the 'blocking' spin policy, but it is not "
+                        << "event driven: its thread sleeps for the 'block_timeout_us' whenever it is idle."
+                        << std::endl;
+            }
+
+            auto strategy = std::make_shared<SpinStrategy>(spin, std::move(wait_handles));
+
+            launch_runner(settings, [this, &ref_mw_name, &ref_systemhandle_info, strategy]()
+                    {
+                        if (spin_system(ref_mw_name, ref_systemhandle_info) == SpinResult::IDLE)
+                        {
+                            strategy->idle();
+                        }
+                        else
+                        {
+                            strategy->worked();
+                        }
+                    });
+        }
+
+        if (_reactor.size() > 0)
+        {
+            launch_runner(executor.reactor, [this]()
+                    {
+                        if (!_reactor.run_once(REACTOR_TIMEOUT) && !_quit)
+                        {
+                            stop_with_error("the reactor has experienced a failure");
+                        }
+                    });
+        }
+    }
+
+    void run_embedded()
+    {
+        if (_quit)
+        {
+            m_running = false;
+            return;
+        }
+
+        if (_info_map.size() < 2)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Attemtping to run an Integration Service instance without at least "
+                    << "two systems (you are using: " << _info_map.size()
+                    << "). An Integration Service instance with less than two systems is "
+                    << "useless, so we will quit soon." << std::endl;
+
+            _quit = true;
+            _return_code = 1;
+            return;
+        }
+
+        /**
+         * The host application owns the threads and the signals of the process, so neither
+         * the executor threads nor the signal handlers are set up.
+         */
+        _embedded = true;
+        start_stall_watchdog();
+
+        if (!_configuration.executor().threads.empty())
+        {
+            _logger << utils::Logger::Level::WARN
+                    << "The executor threads are ignored when the instance is driven "
+                    << "by the application through 'poll_once()'." << std::endl;
+        }
+
+        for (const auto& [mw_name, systemhandle_info] : _info_map)
+        {
+            const auto& ref_mw_name = mw_name;
+            const auto& ref_systemhandle_info = systemhandle_info;
+
+            if (ref_systemhandle_info.event_driven
+                    && _reactor.add(
+                        ref_systemhandle_info.event_driven->wait_handle(),
+                        [this, &ref_mw_name, &ref_systemhandle_info]()
+                        {
+                            return spin_system(ref_mw_name, ref_systemhandle_info) != SpinResult::FAILURE;
+                        }))
+            {
+                continue;
+            }
+
+            _polled_systems.emplace_back(&ref_mw_name, &ref_systemhandle_info);
+        }
+
+        _logger << utils::Logger::Level::DEBUG
+                << "Embedded instance ready: " << _reactor.size() << " system(s) can be waited on, "
+                << _polled_systems.size() << " must be polled." << std::endl;
+    }
+
+    bool poll_once(
+            std::chrono::milliseconds timeout)
+    {
+        if (!_embedded)
+        {
+            if (m_running)
+            {
+                _logger << utils::Logger::Level::ERROR
+                        << "'poll_once()' can only be called on instances started with "
+                        << "'Instance::run_embedded()'." << std::endl;
+            }
+            return false;
+        }
+
+        if (!m_running)
+        {
+            return false;
+        }
+
+        bool worked = false;
+        for (const auto& [mw_name, systemhandle_info] : _polled_systems)
+        {
+            if (_quit)
+            {
+                break;
+            }
+            worked |= (spin_system(*mw_name, *systemhandle_info) == SpinResult::WORK_DONE);
+        }
+
+        /**
+         * Only waits when the polled systems had nothing to do. `quit()` wakes the reactor up.
+         */
+        const std::chrono::milliseconds wait = worked ? std::chrono::milliseconds(0) : timeout;
+        if (!_quit && _reactor.wait_handle() >= 0)
+        {
+            if (!_reactor.run_once(wait) && !_quit)
+            {
+                stop_with_error("the reactor has experienced a failure");
+            }
+        }
+        else if (!_quit && wait.count() > 0)
+        {
+            std::this_thread::sleep_for(wait);
+        }
+
+        if (_quit)
+        {
+            _finished();
+            return false;
+        }
+
+        return true;
+    }
+
+    int wait_handle() const
+    {
+        return _reactor.wait_handle();
+    }
+
+    void quit()
+    {
+        _quit = true;
+        _reactor.wake_up();
+        wake_up_sleepers();
+    }
+
+    DrainReport drain(
+            std::chrono::milliseconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        /**
+         * From now on, reloads are rejected, so that no route gets opened again.
+         */
+        {
+            std::unique_lock<std::mutex> lock(_reload_mutex);
+            _draining = true;
+            _runtime.close_all_routes();
+        }
+
+        _logger << utils::Logger::Level::INFO
+                << "Draining the instance for up to " << timeout.count() << " ms." << std::endl;
+
+        _runtime.flush();
+
+        const auto routes = _runtime.routes();
+        const auto in_flight = [&routes]()
+                {
+                    int64_t total = 0;
+                    for (const auto& route : routes)
+                    {
+                        total += route.second->in_flight.load();
+                    }
+                    return total;
+                };
+
+        /**
+         * The replies can only arrive while the systems keep spinning. Embedded instances are
+         * only spun by `poll_once()`, so they get polled from here.
+         */
+        while (in_flight() > 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            const bool running = _embedded
+                    ? poll_once(DRAIN_CHECK_PERIOD)
+                    : sleep_while_running(DRAIN_CHECK_PERIOD);
+            if (!running)
+            {
+                break;
+            }
+        }
+
+        DrainReport report;
+        for (const auto& [route, state] : routes)
+        {
+            const int64_t unfinished = state->in_flight.load();
+            if (unfinished > 0)
+            {
+                report.complete = false;
+                report.unfinished[route] = unfinished;
+
+                _logger << utils::Logger::Level::WARN
+                        << "Route '" << route << "' dropped " << unfinished
+                        << " message(s) or call(s) in flight." << std::endl;
+            }
+
+            const uint64_t rejected = state->rejected.load();
+            if (rejected > 0)
+            {
+                report.rejected[route] = rejected;
+
+                _logger << utils::Logger::Level::INFO
+                        << "Route '" << route << "' rejected " << rejected
+                        << " message(s) or request(s) while draining." << std::endl;
+            }
+        }
+
+        if (report.complete)
+        {
+            _logger << utils::Logger::Level::INFO
+                    << "The instance was drained without dropping any work in flight." << std::endl;
+        }
+
+        quit();
+        return report;
+    }
+
+    bool reload(
+            const YAML::Node& config_node)
+    {
+        std::unique_lock<std::mutex> lock(_reload_mutex);
+
+        if (_quit || _draining)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Cannot reload the configuration of an instance which is not running." << std::endl;
+            return false;
+        }
+
+        std::unique_ptr<internal::Config> configuration(
+            new internal::Config(config_node, _config_file.empty() ? "<reload>" : _config_file));
+
+        internal::ConfigChanges changes;
+        if (!*configuration || !configuration->changes_from(*_running_configuration, changes))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "The new configuration is not valid, so the instance keeps running "
+                    << "with the current one." << std::endl;
+            return false;
+        }
+
+        if (changes.empty())
+        {
+            _logger << utils::Logger::Level::INFO
+                    << "The configuration has not changed, nothing to reload." << std::endl;
+            return true;
+        }
+
+        /**
+         * Nothing is applied unless every added route is compatible with the running systems,
+         * and every removed one can be torn down without leaving a duplicate behind.
+         */
+        if (!configuration->check_changes(_info_map, changes, _runtime))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Some of the new topics or services are not compatible with the running "
+                    << "systems, so the instance keeps running with the current configuration." << std::endl;
+            return false;
+        }
+
+        bool lingering = false;
+        for (const std::string& topic : changes.topics_added)
+        {
+            if (_lingering_routes.count(internal::RuntimeContext::topic_route(topic)))
+            {
+                _logger << utils::Logger::Level::ERROR
+                        << "The topic '" << topic << "' was removed while some of its systems kept "
+                        << "subscribed to it, so it cannot be added again while running." << std::endl;
+                lingering = true;
+            }
+        }
+
+        for (const std::string& service : changes.services_added)
+        {
+            if (_lingering_routes.count(internal::RuntimeContext::service_route(service)))
+            {
+                _logger << utils::Logger::Level::ERROR
+                        << "The service '" << service << "' was removed while some of its clients kept "
+                        << "their proxies, so it cannot be added again while running." << std::endl;
+                lingering = true;
+            }
+        }
+
+        if (lingering || !_running_configuration->check_tear_down(_info_map, changes))
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Some of the topics or services cannot be replaced by the running systems, "
+                    << "so the instance keeps running with the current configuration." << std::endl;
+            return false;
+        }
+
+        for (const std::string& topic : changes.topics_removed)
+        {
+            if (!_running_configuration->tear_down_topic(_info_map, topic, _runtime))
+            {
+                _lingering_routes.insert(internal::RuntimeContext::topic_route(topic));
+            }
+        }
+
+        for (const std::string& service : changes.services_removed)
+        {
+            if (!_running_configuration->tear_down_service(_info_map, service, _runtime))
+            {
+                _lingering_routes.insert(internal::RuntimeContext::service_route(service));
+            }
+        }
+
+        /**
+         * The routes set up by this configuration refer to the types that it owns,
+         * so it is kept, along with their callbacks, for as long as any of them is alive.
+         */
+        ReloadedConfiguration reloaded;
+
+        bool valid = true;
+        for (const std::string& topic : changes.topics_added)
+        {
+            valid &= configuration->configure_topic(_info_map, topic, reloaded.subscription_callbacks, _runtime);
+        }
+
+        for (const std::string& service : changes.services_added)
+        {
+            valid &= configuration->configure_service(_info_map, service, reloaded.request_callbacks, _runtime);
+        }
+
+        const auto gates = _runtime.routes();
+        const auto keep_gate = [&](const std::string& route)
+                {
+                    const auto it = gates.find(route);
+                    if (it != gates.end())
+                    {
+                        reloaded.gates[route] = it->second;
+                    }
+                };
+
+        for (const std::string& topic : changes.topics_added)
+        {
+            keep_gate(internal::RuntimeContext::topic_route(topic));
+        }
+
+        for (const std::string& service : changes.services_added)
+        {
+            keep_gate(internal::RuntimeContext::service_route(service));
+        }
+
+        _running_configuration = configuration.get();
+        reloaded.configuration = std::move(configuration);
+        _reloaded_configurations.push_back(std::move(reloaded));
+        release_configurations();
+
+        _logger << utils::Logger::Level::INFO
+                << "Configuration reloaded: " << changes.topics_removed.size() << " topic(s) and "
+                << changes.services_removed.size() << " service(s) removed, "
+                << changes.topics_added.size() << " topic(s) and "
+                << changes.services_added.size() << " service(s) added." << std::endl;
+
+        if (!valid)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Some of the new topics or services could not be configured." << std::endl;
+        }
+
+        return valid;
+    }
+
+    int return_code() const
+    {
+        return _return_code;
+    }
+
+    uint64_t page_faults() const
+    {
+        return _page_faults;
+    }
+
+    std::map<std::string, RouteMetrics::Snapshot> metrics() const
+    {
+        std::map<std::string, RouteMetrics::Snapshot> snapshots;
+        for (const auto& [route, route_metrics] : _runtime.metrics())
+        {
+            snapshots[route] = route_metrics->snapshot();
+        }
+        return snapshots;
+    }
+
+    std::map<std::string, LatencyProbe::Snapshot> probes() const
+    {
+        std::map<std::string, LatencyProbe::Snapshot> snapshots;
+        for (const auto& probe : _runtime.probes)
+        {
+            snapshots[probe->name()] = probe->snapshot();
+        }
+        return snapshots;
+    }
+
+    uint16_t metrics_port() const
+    {
+        return _metrics_server ? _metrics_server->port() : 0;
+    }
+
+    Introspection introspect() const
+    {
+        Introspection introspection;
+        {
+            std::unique_lock<std::mutex> lock(_reload_mutex);
+            _running_configuration->describe(_info_map, introspection);
+        }
+
+        const auto gates = _runtime.routes();
+        const auto metrics = _runtime.metrics();
+        const auto fill = [&](const std::string& key, Introspection::Route& route)
+                {
+                    const auto it_gate = gates.find(key);
+                    if (it_gate != gates.end())
+                    {
+                        route.open = it_gate->second->open.load();
+                        route.in_flight = it_gate->second->in_flight.load();
+                        route.rejected = it_gate->second->rejected.load();
+                    }
+
+                    const auto it_metrics = metrics.find(key);
+                    if (it_metrics != metrics.end())
+                    {
+                        route.metrics = it_metrics->second->snapshot();
+                    }
+                };
+
+        for (auto& [topic, route] : introspection.topics)
+        {
+            fill(internal::RuntimeContext::topic_route(topic), route);
+        }
+
+        for (auto& [service, route] : introspection.services)
+        {
+            fill(internal::RuntimeContext::service_route(service), route);
+        }
+
+        if (_runtime.shards)
+        {
+            introspection.shard_queue_depths = _runtime.shards->queue_depths();
+        }
+        introspection.timer_tasks_pending = _runtime.timers.pending();
+
+        for (const auto& [mw_name, stats] : _system_stats)
+        {
+            Introspection::Spin& spin = introspection.spins[mw_name];
+            spin.durations = stats->spins.snapshot();
+            spin.stalls = stats->stalls.load(std::memory_order_relaxed);
+
+            const int64_t since = stats->spinning_since.load(std::memory_order_relaxed);
+            spin.stalled = since != 0 && stats->stalled_spin.load(std::memory_order_relaxed) == since;
+        }
+
+        if (utils::MemoryTracker::enabled())
+        {
+            introspection.memory = utils::MemoryTracker::usage();
+        }
+
+        return introspection;
+    }
+
+    void on_stall(
+            InstanceHandle::StallCallback callback)
+    {
+        std::unique_lock<std::mutex> lock(_stall_mutex);
+        _stall_callback = std::move(callback);
+    }
+
+    int wait()
+    {
+        for (auto& thread : _work_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+
+        join_watchers();
+
+        return _return_code;
+    }
+
+    const TypeRegistry* type_registry(
+            const std::string& middleware_name)
+    {
+        auto it = _info_map.find(middleware_name);
+        if (it == _info_map.end())
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Trying to retrieve the type registry of the middleware named '"
+                    << middleware_name
+                    << ", which does not exist!"
+                    << std::endl;
+
+            return nullptr;
+        }
+
+        return &_info_map.at(middleware_name).types;
+    }
+
+    std::condition_variable m_finished;
+    std::atomic_bool m_running;
+
+private:
+
+    friend class Instance::Implementation;
+
+    /**
+     * Maximum time that the reactor waits for events before checking whether it must stop.
+     */
+    static constexpr std::chrono::milliseconds REACTOR_TIMEOUT{100};
+
+    /**
+     * Period between two checks of the requests received through signals.
+     */
+    static constexpr std::chrono::milliseconds RELOAD_CHECK_PERIOD{500};
+
+    /**
+     * Reloads the config-file whenever a SIGHUP is received, until the instance stops.
+     * It runs on its own thread, since reloading parses files and calls into the middlewares,
+     * which would hold back the short tasks of the timers.
+     */
+    void watch_reload_requests()
+    {
+        while (sleep_while_running(RELOAD_CHECK_PERIOD))
+        {
+            const unsigned int requests = reload_requests;
+            if (requests == _reload_requests_seen)
+            {
+                continue;
+            }
+            _reload_requests_seen = requests;
+
+            _logger << utils::Logger::Level::INFO
+                    << "SIGHUP received: reloading the config-file '" << _config_file << "'." << std::endl;
+
+            try
+            {
+                reload(YAML::LoadFile(_config_file));
+            }
+            catch (const YAML::Exception& e)
+            {
+                _logger << utils::Logger::Level::ERROR
+                        << "Could not parse the config-file '" << _config_file
+                        << "': " << e.what() << std::endl;
+            }
+        }
+    }
+
+    /**
+     * Waits for the given time, or until the instance stops.
+     *
+     * @returns `true` if the instance is still running, `false` otherwise.
+     */
+    bool sleep_while_running(
+            std::chrono::milliseconds time)
+    {
+        std::unique_lock<std::mutex> lock(_sleep_mutex);
+        _sleep_wakeup.wait_for(lock, time, [this]()
+                {
+                    return _quit || interrupted || !m_running;
+                });
+        return !_quit && !interrupted && m_running;
+    }
+
+    /**
+     * Wakes up the threads waiting in `sleep_while_running`, so that they notice that the instance stopped.
+     */
+    void wake_up_sleepers()
+    {
+        std::unique_lock<std::mutex> lock(_sleep_mutex);
+        _sleep_wakeup.notify_all();
+    }
+
+    /**
+     * Releases the reloaded configurations that no route refers to anymore: those whose routes are
+     * all closed, without calls in flight, and detached from the systems that were delivering to them.
+     * Must be called with the reload mutex taken.
+     */
+    void release_configurations()
+    {
+        _reloaded_configurations.remove_if([this](const ReloadedConfiguration& reloaded)
+                {
+                    if (reloaded.configuration.get() == _running_configuration)
+                    {
+                        return false;
+                    }
+
+                    for (const auto& [route, gate] : reloaded.gates)
+                    {
+                        if (gate->open || gate->in_flight > 0 || _lingering_routes.count(route))
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                });
+    }
+
+    /**
+     * Period between two checks of the work in flight while draining.
+     */
+    static constexpr std::chrono::milliseconds DRAIN_CHECK_PERIOD{10};
+
+    /**
+     * Drains the instance when a SIGTERM is received, unless it stops before.
+     * It runs on its own thread, created along with the instance, since draining blocks
+     * until the work in flight finishes.
+     */
+    void watch_drain_requests()
+    {
+        while (sleep_while_running(RELOAD_CHECK_PERIOD))
+        {
+            if (drain_requests == _drain_requests_seen)
+            {
+                continue;
+            }
+            _drain_requests_seen = drain_requests;
+
+            _logger << utils::Logger::Level::INFO
+                    << "SIGTERM received: draining the instance." << std::endl;
+
+            drain(_configuration.executor().drain_timeout);
+            return;
+        }
+    }
+
+    /**
+     * Logs the report of the profiler whenever a SIGUSR1 is received, until the instance stops.
+     * It runs on its own thread, since building the report locks the profiler and formats
+     * every entry, which would hold back the short tasks of the timers.
+     */
+    void watch_profile_requests()
+    {
+        while (sleep_while_running(RELOAD_CHECK_PERIOD))
+        {
+            const unsigned int requests = profile_requests;
+            if (requests == _profile_requests_seen)
+            {
+                continue;
+            }
+            _profile_requests_seen = requests;
+
+            log_profile("SIGUSR1 received");
+        }
+    }
+
+    /**
+     * Starts watching the stalls of the systems, if a threshold is configured.
+     * The watchdog runs on its own thread rather than on the timers, whose tasks publish
+     * into the middlewares and could get blocked by the very stall being watched.
+     */
+    void start_stall_watchdog()
+    {
+        if (_configuration.executor().stall_threshold.count() > 0)
+        {
+            _stall_notifier_thread = std::thread([this]()
+                            {
+                                notify_stalls();
+                            });
+            _watchdog_thread = std::thread([this]()
+                            {
+                                watch_stalls();
+                            });
+        }
+    }
+
+    /**
+     * Checks the spins of the systems four times per threshold, until the instance stops,
+     * so that a stall is noticed before it lasts much longer than the threshold.
+     */
+    void watch_stalls()
+    {
+        const std::chrono::milliseconds period =
+                std::max(_configuration.executor().stall_threshold / 4, std::chrono::milliseconds(1));
+        while (sleep_while_running(period))
+        {
+            check_stalls();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(_stall_mutex);
+            _stall_watchdog_stopped = true;
+        }
+        _stall_wakeup.notify_all();
+    }
+
+    /**
+     * Reports the systems that have been in their current spin for longer than the threshold,
+     * once per spin. The callback of the application, if any, gets notified by `notify_stalls()`.
+     */
+    void check_stalls()
+    {
+        const std::chrono::milliseconds threshold = _configuration.executor().stall_threshold;
+        const int64_t now = steady_nanoseconds();
+
+        for (const auto& [mw_name, stats] : _system_stats)
+        {
+            const int64_t since = stats->spinning_since.load(std::memory_order_relaxed);
+            if (since == 0)
+            {
+                continue;
+            }
+
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::nanoseconds(now - since));
+            if (duration < threshold || stats->stalled_spin.exchange(since) == since)
+            {
+                continue;
+            }
+
+            stats->stalls.fetch_add(1, std::memory_order_relaxed);
+            _logger << utils::Logger::Level::WARN
+                    << "The system '" << mw_name << "' has been stuck for " << duration.count()
+                    << " ms in a single spin: its middleware is not being served." << std::endl;
+
+            {
+                std::unique_lock<std::mutex> lock(_stall_mutex);
+                if (!_stall_callback)
+                {
+                    continue;
+                }
+                _stalls.emplace_back(mw_name, duration);
+            }
+            _stall_wakeup.notify_one();
+        }
+    }
+
+    /**
+     * Calls the stall callback of the application for each stall, from a thread of its own,
+     * so that a slow callback delays the next notifications but never the watchdog.
+     * Finishes once the watchdog has stopped and every stall has been notified.
+     */
+    void notify_stalls()
+    {
+        std::unique_lock<std::mutex> lock(_stall_mutex);
+        while (true)
+        {
+            _stall_wakeup.wait(lock, [this]()
+                    {
+                        return !_stalls.empty() || _stall_watchdog_stopped;
+                    });
+
+            if (_stalls.empty())
+            {
+                return;
+            }
+
+            const auto [system, duration] = _stalls.front();
+            _stalls.pop_front();
+            const InstanceHandle::StallCallback callback = _stall_callback;
+
+            lock.unlock();
+            if (callback)
+            {
+                callback(system, duration);
+            }
+            lock.lock();
+        }
+    }
+
+    /**
+     * Joins the threads that watch the signals and the stalls, once they notice that the instance stopped.
+     */
+    void join_watchers()
+    {
+        for (std::thread* thread : {&_drain_thread, &_reload_thread, &_profile_thread, &_watchdog_thread,
+                                    &_stall_notifier_thread})
+        {
+            if (thread->joinable())
+            {
+                thread->join();
+            }
+        }
+    }
+
+    /**
+     * Logs the report of the profiler, ranked by the time spent in each conversion.
+     */
+    void log_profile(
+            const char* reason)
+    {
+        _logger << utils::Logger::Level::INFO
+                << reason << ": profile of the conversions, ranked by total time:\n"
+                << utils::Profiler::dump(_configuration.profiler().report_size) << std::endl;
+    }
+
+    /**
+     * Writes the metrics of the instance in the Prometheus text exposition format.
+     * It only reads counters, so it can be called from any thread while the instance runs.
+     */
+    std::string render_metrics() const
+    {
+        std::ostringstream out;
+
+        const auto escape = [](const std::string& label)
+                {
+                    std::string escaped;
+                    for (const char c : label)
+                    {
+                        if (c == '\\' || c == '"')
+                        {
+                            escaped += '\\';
+                            escaped += c;
+                        }
+                        else if (c == '\n')
+                        {
+                            escaped += "\\n";
+                        }
+                        else
+                        {
+                            escaped += c;
+                        }
+                    }
+                    return escaped;
+                };
+
+        const auto header = [&out](const char* name, const char* type, const char* help)
+                {
+                    out << "# HELP " << name << " " << help << "\n"
+                        << "# TYPE " << name << " " << type << "\n";
+                };
+
+        const auto seconds = [](uint64_t nanoseconds)
+                {
+                    return static_cast<double>(nanoseconds) * 1e-9;
+                };
+
+        const auto routes = _runtime.metrics();
+        std::map<std::string, RouteMetrics::Snapshot> snapshots;
+        for (const auto& [route, route_metrics] : routes)
+        {
+            snapshots[route] = route_metrics->snapshot();
+        }
+
+        header("is_route_messages_total", "counter", "Messages or requests forwarded by the route.");
+        for (const auto& [route, snapshot] : snapshots)
+        {
+            out << "is_route_messages_total{route=\"" << escape(route) << "\"} " << snapshot.messages << "\n";
+        }
+
+        header("is_route_dropped_total", "counter", "Messages or requests discarded by the route.");
+        for (const auto& [route, snapshot] : snapshots)
+        {
+            out << "is_route_dropped_total{route=\"" << escape(route) << "\"} " << snapshot.dropped << "\n";
+        }
+
+        const auto summary = [&](const char* name, const char* help,
+                        LatencyHistogram::Snapshot RouteMetrics::Snapshot::* histogram)
+                {
+                    header(name, "summary", help);
+                    for (const auto& [route, snapshot] : snapshots)
+                    {
+                        const LatencyHistogram::Snapshot& latencies = snapshot.*histogram;
+                        const std::string label = "route=\"" + escape(route) + "\"";
+                        for (const double quantile : {0.5, 0.9, 0.99, 0.999})
+                        {
+                            out << name << "{" << label << ",quantile=\"" << quantile << "\"} "
+                                << seconds(latencies.percentile(quantile)) << "\n";
+                        }
+                        out << name << "_sum{" << label << "} " << seconds(latencies.sum) << "\n"
+                            << name << "_count{" << label << "} " << latencies.count << "\n";
+                    }
+                };
+
+        summary("is_route_conversion_seconds",
+                "Time spent converting each message into the type of a destination.",
+                &RouteMetrics::Snapshot::conversion);
+        summary("is_route_publish_seconds",
+                "Time spent handing each message over to a destination.",
+                &RouteMetrics::Snapshot::publish);
+
+        const auto gates = _runtime.routes();
+
+        header("is_route_in_flight", "gauge", "Messages being forwarded and service calls waiting for their reply.");
+        for (const auto& [route, state] : gates)
         {
-            _logger << utils::Logger::Level::ERROR
-                    << "Failed to configure topics!" << std::endl;
-            return false;
+            out << "is_route_in_flight{route=\"" << escape(route) << "\"} " << state->in_flight.load() << "\n";
         }
 
-        if (!_configuration.configure_services(_info_map, request_callbacks_))
+        header("is_route_rejected_total", "counter", "Messages or requests received while the route was closed.");
+        for (const auto& [route, state] : gates)
         {
-            _logger << utils::Logger::Level::ERROR
-                    << "Failed to configure services!" << std::endl;
-            return false;
+            out << "is_route_rejected_total{route=\"" << escape(route) << "\"} " << state->rejected.load() << "\n";
         }
 
-        _logger << utils::Logger::Level::DEBUG
-                << "Integration Service instance successfully configured." << std::endl;
-        return true;
-    }
-
-    void run()
-    {
-        if (_quit)
+        const auto probes = this->probes();
+        if (!probes.empty())
         {
-            m_running = false;
-            return;
+            header("is_probe_sent_total", "counter", "Probe messages published by the instance.");
+            for (const auto& [probe, snapshot] : probes)
+            {
+                out << "is_probe_sent_total{probe=\"" << escape(probe) << "\"} " << snapshot.sent << "\n";
+            }
+
+            header("is_probe_received_total", "counter", "Probe messages received by the instance.");
+            for (const auto& [probe, snapshot] : probes)
+            {
+                out << "is_probe_received_total{probe=\"" << escape(probe) << "\"} " << snapshot.received << "\n";
+            }
+
+            header("is_probe_lost_total", "counter", "Probe messages that never arrived.");
+            for (const auto& [probe, snapshot] : probes)
+            {
+                out << "is_probe_lost_total{probe=\"" << escape(probe) << "\"} " << snapshot.lost << "\n";
+            }
+
+            header("is_probe_latency_seconds", "summary", "End-to-end latency of the probe messages.");
+            for (const auto& [probe, snapshot] : probes)
+            {
+                const std::string label = "probe=\"" + escape(probe) + "\"";
+                for (const double quantile : {0.5, 0.9, 0.99, 0.999})
+                {
+                    out << "is_probe_latency_seconds{" << label << ",quantile=\"" << quantile << "\"} "
+                        << seconds(snapshot.latency.percentile(quantile)) << "\n";
+                }
+                out << "is_probe_latency_seconds_sum{" << label << "} " << seconds(snapshot.latency.sum) << "\n"
+                    << "is_probe_latency_seconds_count{" << label << "} " << snapshot.latency.count << "\n";
+            }
         }
 
-        /**
-         * It is pointless to run the *Integration Service* with less than two systems involved.
-         */
-        if (_info_map.size() < 2)
+        header("is_system_up", "gauge", "Whether the system is being run by the instance, and has not failed.");
+        for (const auto& [mw_name, stats] : _system_stats)
         {
-            _logger << utils::Logger::Level::ERROR
-                    << "Attemtping to run an Integration Service instance without at least "
-                    << "two systems (you are using: " << _info_map.size()
-                    << "). An Integration Service instance with less than two systems is "
-                    << "useless, so we will quit soon." << std::endl;
+            const bool up = m_running && !stats->failed.load(std::memory_order_relaxed);
+            out << "is_system_up{system=\"" << escape(mw_name) << "\"} " << (up ? 1 : 0) << "\n";
+        }
 
-            _quit = true;
-            _return_code = 1;
-            return;
+        header("is_system_spin_seconds", "summary", "Time spent in each spin of the system.");
+        for (const auto& [mw_name, stats] : _system_stats)
+        {
+            const LatencyHistogram::Snapshot spins = stats->spins.snapshot();
+            const std::string label = "system=\"" + escape(mw_name) + "\"";
+            for (const double quantile : {0.5, 0.9, 0.99, 0.999})
+            {
+                out << "is_system_spin_seconds{" << label << ",quantile=\"" << quantile << "\"} "
+                    << seconds(spins.percentile(quantile)) << "\n";
+            }
+            out << "is_system_spin_seconds_sum{" << label << "} " << seconds(spins.sum) << "\n"
+                << "is_system_spin_seconds_count{" << label << "} " << spins.count << "\n";
         }
 
-        /**
-         * Increments the number of active instances.
-         */
+        header("is_system_stalls_total", "counter", "Spins of the system that lasted longer than the stall threshold.");
+        for (const auto& [mw_name, stats] : _system_stats)
         {
-            std::unique_lock<std::mutex> lock(change_interruption_mutex);
-            signal(SIGINT, interruption_handler);
-            ++interruptable_instances;
+            out << "is_system_stalls_total{system=\"" << escape(mw_name) << "\"} "
+                << stats->stalls.load(std::memory_order_relaxed) << "\n";
         }
 
-        _work_threads.reserve(_info_map.size());
+        header("is_page_faults_total", "counter", "Page faults suffered by the threads after their warm-up.");
+        out << "is_page_faults_total " << _page_faults.load() << "\n";
 
-        for (const auto& [mw_name, systemhandle_info] : _info_map)
+        header("is_timer_tasks_pending", "gauge", "Deferred route tasks waiting for their deadline.");
+        out << "is_timer_tasks_pending " << _runtime.timers.pending() << "\n";
+
+        if (_runtime.shards)
         {
-            /**
-             * For each systemhandle, creates a working thread that will check that the
-             * SystemHandle instance is alive and calls spin_once() to execute pending work.
-             */
-            const auto& ref_mw_name = mw_name;
-            const auto& ref_systemhandle_info = systemhandle_info;
-            auto runner = [&]()
-                    {
-                        ++_active_middlewares;
+            header("is_shard_queue_depth", "gauge", "Messages waiting to be forwarded by each shard.");
+            const std::vector<std::size_t> depths = _runtime.shards->queue_depths();
+            for (std::size_t shard = 0; shard < depths.size(); ++shard)
+            {
+                out << "is_shard_queue_depth{shard=\"" << shard << "\"} " << depths[shard] << "\n";
+            }
+        }
 
-                        while (!interrupted && !_quit)
-                        {
-                            const bool okay = ref_systemhandle_info.handle->spin_once();
+        if (utils::MemoryTracker::enabled())
+        {
+            const auto usage = utils::MemoryTracker::usage();
 
-                            if (!okay)
-                            {
-                                _quit = true;
-                                _return_code = 1;
-                                _logger << utils::Logger::Level::ERROR
-                                        << "Runtime Error: SystemHandle of middleware named '"
-                                        << ref_mw_name
-                                        << "' has experienced a failure! We will now quit."
-                                        << std::endl;
-                            }
-                        }
+            header("is_memory_live_bytes", "gauge", "Memory allocated and not freed yet, by account.");
+            for (const auto& [account, account_usage] : usage)
+            {
+                out << "is_memory_live_bytes{account=\"" << escape(account) << "\"} "
+                    << account_usage.live_bytes << "\n";
+            }
 
-                        --_active_middlewares;
-                        if (_active_middlewares == 0)
-                        {
-                            _finished();
-                        }
-                    };
+            header("is_memory_allocated_bytes_total", "counter", "Memory allocated so far, by account.");
+            for (const auto& [account, account_usage] : usage)
+            {
+                out << "is_memory_allocated_bytes_total{account=\"" << escape(account) << "\"} "
+                    << account_usage.allocated_bytes << "\n";
+            }
 
-            _work_threads.emplace_back(runner);
+            header("is_memory_allocations_total", "counter", "Allocations made so far, by account.");
+            for (const auto& [account, account_usage] : usage)
+            {
+                out << "is_memory_allocations_total{account=\"" << escape(account) << "\"} "
+                    << account_usage.allocations << "\n";
+            }
         }
-    }
 
-    void quit()
-    {
-        _quit = true;
+        return out.str();
     }
 
-    int return_code() const
+    using SpinResult = SystemHandle::SpinResult;
+
+    /**
+     * Figures of a system, updated by its runner and read by the stall watchdog.
+     * The spins are identified by the steady clock time when they started, in nanoseconds.
+     */
+    struct SystemStats
     {
-        return _return_code;
+        utils::MemoryTracker::Account* memory = nullptr;
+        LatencyHistogram spins;
+        std::atomic<int64_t> spinning_since{0};
+        std::atomic<int64_t> stalled_spin{0};
+        std::atomic<uint64_t> stalls{0};
+        std::atomic_bool failed{false};
+    };
+
+    static int64_t steady_nanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
     }
 
-    int wait()
+    /**
+     * Spins a SystemHandle once, asking every runner to stop if it fails.
+     */
+    SpinResult spin_system(
+            const std::string& mw_name,
+            const is::internal::SystemHandleInfo& systemhandle_info)
     {
-        for (auto& thread : _work_threads)
+        SystemStats& stats = *_system_stats.at(mw_name);
+        const utils::MemoryTracker::Scope memory(stats.memory);
+
+        /**
+         * Reloads and on-demand topics change the routes of the system between two spins.
+         */
+        std::unique_lock<std::mutex> lock(systemhandle_info.spin_mutex);
+
+        const int64_t start = steady_nanoseconds();
+        stats.spinning_since.store(start, std::memory_order_relaxed);
+
+        IS_TRACEPOINT(spin_entry, mw_name.c_str());
+        const SpinResult result = systemhandle_info.handle->spin_and_report();
+        IS_TRACEPOINT(spin_exit, mw_name.c_str(), static_cast<int>(result));
+        lock.unlock();
+
+        const int64_t duration = steady_nanoseconds() - start;
+        stats.spinning_since.store(0, std::memory_order_relaxed);
+        stats.spins.record(static_cast<uint64_t>(duration));
+
+        if (stats.stalled_spin.load(std::memory_order_relaxed) == start)
         {
-            if (thread.joinable())
-            {
-                thread.join();
-            }
+            _logger << utils::Logger::Level::WARN
+                    << "The system '" << mw_name << "' resumed after spending "
+                    << duration / 1000000 << " ms in a single spin." << std::endl;
         }
 
-        return _return_code;
-    }
-
-    const TypeRegistry* type_registry(
-            const std::string& middleware_name)
-    {
-        auto it = _info_map.find(middleware_name);
-        if (it == _info_map.end())
+        if (result == SpinResult::FAILURE)
         {
+            stats.failed.store(true, std::memory_order_relaxed);
+            _quit = true;
+            _return_code = 1;
             _logger << utils::Logger::Level::ERROR
-                    << "Trying to retrieve the type registry of the middleware named '"
-                    << middleware_name
-                    << ", which does not exist!"
+                    << "Runtime Error: SystemHandle of middleware named '"
+                    << mw_name
+                    << "' has experienced a failure! We will now quit."
                     << std::endl;
-
-            return nullptr;
         }
 
-        return &_info_map.at(middleware_name).types;
+        return result;
     }
 
-    std::condition_variable m_finished;
-    std::atomic_bool m_running;
+    using SystemEntry = std::pair<const std::string*, const is::internal::SystemHandleInfo*>;
 
-private:
+    /**
+     * Period between two checks of the page faults suffered by a spinning thread in real-time mode.
+     */
+    static constexpr std::chrono::milliseconds PAGE_FAULT_CHECK_PERIOD{100};
 
-    friend class Instance::Implementation;
+    /**
+     * Launches a working thread, which repeats the given work until the instance is stopped.
+     */
+    void launch_runner(
+            const ThreadSettings& settings,
+            std::function<void()> work)
+    {
+        ++_active_middlewares;
+
+        _work_threads.emplace_back([this, settings, work]()
+                {
+                    const RealtimeSettings& realtime = _configuration.executor().realtime;
+
+                    if (!settings.apply() && realtime.enabled)
+                    {
+                        stop_with_error("the settings of the thread '" + settings.name + "' could not be applied");
+                    }
+
+                    if (realtime.enabled)
+                    {
+                        realtime.prefault_current_stack();
+                    }
+
+                    /**
+                     * Page faults are only monitored once the thread has had time to fault in its working set,
+                     * and then sampled periodically, since reading them takes a system call.
+                     */
+                    auto next_page_fault_check = std::chrono::steady_clock::now() + realtime.warmup;
+                    std::unique_ptr<PageFaultMonitor> page_faults;
+
+                    while (!interrupted && !_quit)
+                    {
+                        work();
+
+                        if (!realtime.enabled)
+                        {
+                            continue;
+                        }
+
+                        const auto now = std::chrono::steady_clock::now();
+                        if (now < next_page_fault_check)
+                        {
+                            continue;
+                        }
+                        next_page_fault_check = now + PAGE_FAULT_CHECK_PERIOD;
+
+                        if (!page_faults)
+                        {
+                            page_faults.reset(new PageFaultMonitor());
+                            continue;
+                        }
+
+                        const uint64_t faults = page_faults->poll();
+                        if (faults > 0)
+                        {
+                            _page_faults += faults;
+
+                            if (realtime.fail_on_page_fault)
+                            {
+                                stop_with_error("the thread '" + settings.name + "' suffered "
+                                        + std::to_string(faults) + " page fault(s) in the hot path");
+                            }
+                        }
+                    }
+
+                    if (--_active_middlewares == 0)
+                    {
+                        _finished();
+                    }
+                });
+    }
+
+    void stop_with_error(
+            const std::string& reason)
+    {
+        _quit = true;
+        _return_code = 1;
+        _logger << utils::Logger::Level::ERROR
+                << "Runtime Error: " << reason << "! We will now quit." << std::endl;
+    }
 
     void _finished()
     {
+        if (!_embedded)
         {
             /**
              * If there are no more *Integration Service* instances running in this process,
@@ -254,10 +1660,31 @@ private:
             {
                 signal(SIGINT, SIG_DFL);
             }
+
+            if (!_config_file.empty() && --reloadable_instances == 0)
+            {
+                signal(SIGHUP, SIG_DFL);
+            }
+
+            if (_configuration.executor().drain_timeout.count() > 0 && --drainable_instances == 0)
+            {
+                signal(SIGTERM, SIG_DFL);
+            }
+
+            if (_configuration.profiler().enabled && --profiled_instances == 0)
+            {
+                signal(SIGUSR1, SIG_DFL);
+            }
+        }
+
+        if (_configuration.profiler().enabled)
+        {
+            log_profile("Shutting down");
         }
 
         m_running = false;
         m_finished.notify_all();
+        wake_up_sleepers();
     }
 
     /**
@@ -267,8 +1694,76 @@ private:
 
     internal::Config _configuration;
 
+    const internal::Config* _running_configuration;
+
+    /**
+     * A configuration loaded by `reload`, along with the gates and the callbacks of the routes that it set up.
+     */
+    struct ReloadedConfiguration
+    {
+        std::unique_ptr<internal::Config> configuration;
+        std::map<std::string, internal::RuntimeContext::RouteGate> gates;
+        internal::Config::SubscriptionCallbacks subscription_callbacks;
+        internal::Config::RequestCallbacks request_callbacks;
+    };
+
+    std::list<ReloadedConfiguration> _reloaded_configurations;
+
+    /**
+     * Routes removed while some of their systems kept delivering to them.
+     */
+    std::set<std::string> _lingering_routes;
+
+    std::string _config_file;
+
+    mutable std::mutex _reload_mutex;
+
+    unsigned int _reload_requests_seen;
+
+    unsigned int _drain_requests_seen;
+
+    unsigned int _profile_requests_seen;
+
+    std::atomic_bool _draining;
+
+    bool _embedded;
+
+    std::vector<SystemEntry> _polled_systems;
+
+    std::unique_ptr<MetricsServer> _metrics_server;
+
+    std::thread _drain_thread;
+
+    std::thread _reload_thread;
+
+    std::thread _profile_thread;
+
+    std::thread _watchdog_thread;
+
+    std::thread _stall_notifier_thread;
+
+    std::mutex _sleep_mutex;
+
+    std::condition_variable _sleep_wakeup;
+
+    internal::RuntimeContext _runtime;
+
+    Reactor _reactor;
+
     is::internal::SystemHandleInfoMap _info_map;
 
+    std::map<std::string, std::unique_ptr<SystemStats> > _system_stats;
+
+    std::mutex _stall_mutex;
+
+    std::condition_variable _stall_wakeup;
+
+    InstanceHandle::StallCallback _stall_callback;
+
+    std::deque<std::pair<std::string, std::chrono::milliseconds> > _stalls;
+
+    bool _stall_watchdog_stopped = false;
+
     internal::Config::SubscriptionCallbacks subscription_callbacks_;
 
     internal::Config::RequestCallbacks request_callbacks_;
@@ -279,6 +1774,8 @@ private:
 
     std::atomic_int _return_code;
 
+    std::atomic<uint64_t> _page_faults;
+
     utils::Logger _logger;
 };
 
@@ -507,7 +2004,8 @@ public:
         return _configuration;
     }
 
-    InstanceHandle run()
+    InstanceHandle run(
+            bool embedded = false)
     {
         if (!_run_instance)
         {
@@ -527,8 +2025,16 @@ public:
         }
 
         std::shared_ptr<InstanceHandle::Implementation> handle
-            = std::make_shared<InstanceHandle::Implementation>(_configuration);
-        handle->run();
+            = std::make_shared<InstanceHandle::Implementation>(
+            _configuration, _config_file == "<internal>" ? "" : _config_file);
+        if (embedded)
+        {
+            handle->run_embedded();
+        }
+        else
+        {
+            handle->run();
+        }
 
         // Save a weak reference to this handle so that we can keep track of whether
         // it's still running.
@@ -609,6 +2115,70 @@ InstanceHandle& InstanceHandle::quit()
     return *this;
 }
 
+//==============================================================================
+bool InstanceHandle::reload(
+        const YAML::Node& config_node)
+{
+    return _pimpl->reload(config_node);
+}
+
+//==============================================================================
+bool InstanceHandle::poll_once(
+        std::chrono::milliseconds timeout)
+{
+    return _pimpl->poll_once(timeout);
+}
+
+//==============================================================================
+int InstanceHandle::wait_handle() const
+{
+    return _pimpl->wait_handle();
+}
+
+//==============================================================================
+DrainReport InstanceHandle::drain(
+        std::chrono::milliseconds timeout)
+{
+    return _pimpl->drain(timeout);
+}
+
+//==============================================================================
+uint64_t InstanceHandle::page_faults() const
+{
+    return _pimpl->page_faults();
+}
+
+//==============================================================================
+std::map<std::string, RouteMetrics::Snapshot> InstanceHandle::metrics() const
+{
+    return _pimpl->metrics();
+}
+
+//==============================================================================
+Introspection InstanceHandle::introspect() const
+{
+    return _pimpl->introspect();
+}
+
+//==============================================================================
+std::map<std::string, LatencyProbe::Snapshot> InstanceHandle::probes() const
+{
+    return _pimpl->probes();
+}
+
+//==============================================================================
+uint16_t InstanceHandle::metrics_port() const
+{
+    return _pimpl->metrics_port();
+}
+
+//==============================================================================
+void InstanceHandle::on_stall(
+        StallCallback callback)
+{
+    _pimpl->on_stall(std::move(callback));
+}
+
 //==============================================================================
 const TypeRegistry* InstanceHandle::type_registry(
         const std::string& middleware_name)
@@ -677,6 +2247,12 @@ InstanceHandle Instance::run()
     return _pimpl->run();
 }
 
+//==============================================================================
+InstanceHandle Instance::run_embedded()
+{
+    return _pimpl->run(true);
+}
+
 } //  namespace core
 
 //==============================================================================
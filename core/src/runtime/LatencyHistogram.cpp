@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/LatencyHistogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+constexpr uint64_t SUB_BUCKETS = uint64_t(1) << LatencyHistogram::SUB_BUCKET_BITS;
+
+/**
+ * Position of the most significant bit set. The value must not be zero.
+ */
+unsigned int most_significant_bit(
+        uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<unsigned int>(__builtin_clzll(value));
+#else
+    unsigned int bit = 0;
+    while (value >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+#endif //  defined(__GNUC__) || defined(__clang__)
+}
+
+} //  anonymous namespace
+
+//==============================================================================
+uint64_t LatencyHistogram::Snapshot::percentile(
+        double quantile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    quantile = std::min(std::max(quantile, 0.0), 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * count)));
+
+    uint64_t accumulated = 0;
+    for (std::size_t bucket = 0; bucket < buckets.size(); ++bucket)
+    {
+        accumulated += buckets[bucket];
+        if (accumulated >= rank)
+        {
+            return std::min(upper_bound(bucket), max);
+        }
+    }
+
+    return max;
+}
+
+//==============================================================================
+double LatencyHistogram::Snapshot::mean() const
+{
+    return count == 0 ? 0.0 : static_cast<double>(sum) / count;
+}
+
+//==============================================================================
+LatencyHistogram::Snapshot& LatencyHistogram::Snapshot::operator +=(
+        const Snapshot& other)
+{
+    buckets.resize(std::max(buckets.size(), other.buckets.size()), 0);
+    for (std::size_t bucket = 0; bucket < other.buckets.size(); ++bucket)
+    {
+        buckets[bucket] += other.buckets[bucket];
+    }
+
+    count += other.count;
+    sum += other.sum;
+    max = std::max(max, other.max);
+    return *this;
+}
+
+//==============================================================================
+LatencyHistogram::LatencyHistogram()
+{
+    for (auto& bucket : _buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+//==============================================================================
+void LatencyHistogram::record(
+        uint64_t nanoseconds)
+{
+    _buckets[bucket_of(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    Stripe& stripe = _stripes[stripe_index()];
+    stripe.sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    uint64_t max = stripe.max.load(std::memory_order_relaxed);
+    while (nanoseconds > max && !stripe.max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+//==============================================================================
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.resize(BUCKETS);
+
+    /**
+     * The count is computed from the buckets, so that it is consistent with them
+     * even if values are being recorded meanwhile.
+     */
+    for (std::size_t bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        snapshot.buckets[bucket] = _buckets[bucket].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[bucket];
+    }
+
+    for (const Stripe& stripe : _stripes)
+    {
+        snapshot.sum += stripe.sum.load(std::memory_order_relaxed);
+        snapshot.max = std::max(snapshot.max, stripe.max.load(std::memory_order_relaxed));
+    }
+    return snapshot;
+}
+
+//==============================================================================
+std::size_t LatencyHistogram::stripe_index()
+{
+    static std::atomic<std::size_t> next_stripe(0);
+    thread_local const std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % STRIPES;
+    return stripe;
+}
+
+//==============================================================================
+std::size_t LatencyHistogram::bucket_of(
+        uint64_t nanoseconds)
+{
+    if (nanoseconds < SUB_BUCKETS)
+    {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+
+    const unsigned int bit = most_significant_bit(nanoseconds);
+    const unsigned int shift = bit - SUB_BUCKET_BITS;
+    const uint64_t sub_bucket = (nanoseconds >> shift) & (SUB_BUCKETS - 1);
+    return static_cast<std::size_t>((shift + 1) * SUB_BUCKETS + sub_bucket);
+}
+
+//==============================================================================
+uint64_t LatencyHistogram::upper_bound(
+        std::size_t bucket)
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    const unsigned int shift = static_cast<unsigned int>(bucket / SUB_BUCKETS) - 1;
+    const uint64_t sub_bucket = bucket % SUB_BUCKETS;
+    const uint64_t lower = (SUB_BUCKETS + sub_bucket) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
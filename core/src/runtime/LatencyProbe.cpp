@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/runtime/LatencyProbe.hpp>
+#include <is/utils/Log.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+/**
+ * Number of sequences, below the highest received, whose arrival is remembered,
+ * so that the messages arriving out of order within it are not counted as lost.
+ */
+constexpr uint64_t REORDER_WINDOW = 64;
+
+} //  anonymous namespace
+
+class LatencyProbe::Implementation : public std::enable_shared_from_this<Implementation>
+{
+public:
+
+    Implementation(
+            const std::string& name,
+            const xtypes::DynamicType& type)
+        : _name(name)
+        , _type(type)
+        , _sequence(0)
+        , _sent(0)
+        , _received(0)
+        , _lost(0)
+        , _highest_received(0)
+        , _received_window(0)
+        , _logger("is::core::LatencyProbe")
+    {
+    }
+
+    const std::string& name() const
+    {
+        return _name;
+    }
+
+    bool start(
+            std::shared_ptr<TopicPublisher> publisher,
+            std::chrono::milliseconds period,
+            TimerQueue& timers)
+    {
+        return schedule(std::move(publisher), period, timers, TimerQueue::Clock::now() + period);
+    }
+
+    void receive(
+            const xtypes::DynamicData& message)
+    {
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        if (message["origin"].value<std::string>() != _name)
+        {
+            return;
+        }
+
+        const uint64_t sequence = message["sequence"].value<uint64_t>();
+        const int64_t sent_ns = message["sent_ns"].value<int64_t>();
+
+        /**
+         * The sequences skipped are counted as lost, until they arrive late. Bit `n` of the window
+         * tells whether the sequence `n` places below the highest one has been received.
+         * Messages arriving even later keep being counted as lost, since they cannot be told
+         * apart from duplicates.
+         */
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (sequence > _highest_received)
+            {
+                const uint64_t skipped = sequence - _highest_received - 1;
+                _lost.fetch_add(skipped, std::memory_order_relaxed);
+
+                const uint64_t shift = sequence - _highest_received;
+                _received_window = shift < REORDER_WINDOW ? (_received_window << shift) | 1 : 1;
+                _highest_received = sequence;
+            }
+            else if (_highest_received - sequence < REORDER_WINDOW)
+            {
+                const uint64_t bit = uint64_t(1) << (_highest_received - sequence);
+                if (_received_window & bit)
+                {
+                    return;
+                }
+
+                _received_window |= bit;
+                _lost.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else if (sequence <= REORDER_WINDOW)
+            {
+                /**
+                 * The sequences start over from one when the sending side is restarted.
+                 */
+                _lost.fetch_add(sequence - 1, std::memory_order_relaxed);
+                _highest_received = sequence;
+                _received_window = 1;
+            }
+        }
+
+        _received.fetch_add(1, std::memory_order_relaxed);
+        _latency.record(static_cast<uint64_t>(now > sent_ns ? now - sent_ns : 0));
+    }
+
+    Snapshot snapshot() const
+    {
+        Snapshot snapshot;
+        snapshot.sent = _sent.load(std::memory_order_relaxed);
+        snapshot.received = _received.load(std::memory_order_relaxed);
+        snapshot.lost = _lost.load(std::memory_order_relaxed);
+        snapshot.latency = _latency.snapshot();
+        return snapshot;
+    }
+
+private:
+
+    /**
+     * Every probe message schedules the next one, as long as the probe is alive.
+     * The deadlines are kept on a fixed grid, so that slow publications do not make the period drift.
+     */
+    bool schedule(
+            std::shared_ptr<TopicPublisher> publisher,
+            std::chrono::milliseconds period,
+            TimerQueue& timers,
+            TimerQueue::Clock::time_point deadline)
+    {
+        std::weak_ptr<Implementation> weak_self = shared_from_this();
+        return timers.schedule(deadline, [weak_self, publisher, period, &timers, deadline]()
+                       {
+                           if (auto self = weak_self.lock())
+                           {
+                               self->send(*publisher);
+                               self->schedule(publisher, period, timers, deadline + period);
+                           }
+                       });
+    }
+
+    void send(
+            TopicPublisher& publisher)
+    {
+        xtypes::DynamicData message(_type);
+        message["origin"] = _name;
+        message["sequence"] = _sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+        message["sent_ns"] = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+
+        if (publisher.publish(message))
+        {
+            _sent.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            _logger << utils::Logger::Level::WARN
+                    << "Failed to publish a message of the probe '" << _name << "'." << std::endl;
+        }
+    }
+
+    const std::string _name;
+    const xtypes::DynamicType& _type;
+
+    std::atomic<uint64_t> _sequence;
+    std::atomic<uint64_t> _sent;
+    std::atomic<uint64_t> _received;
+    std::atomic<uint64_t> _lost;
+
+    std::mutex _mutex;
+    uint64_t _highest_received;
+    uint64_t _received_window;
+
+    LatencyHistogram _latency;
+
+    utils::Logger _logger;
+};
+
+//==============================================================================
+LatencyProbe::LatencyProbe(
+        const std::string& name,
+        const xtypes::DynamicType& type)
+    : _pimpl(std::make_shared<Implementation>(name, type))
+{
+}
+
+//==============================================================================
+const std::string& LatencyProbe::name() const
+{
+    return _pimpl->name();
+}
+
+//==============================================================================
+bool LatencyProbe::start(
+        std::shared_ptr<TopicPublisher> publisher,
+        std::chrono::milliseconds period,
+        TimerQueue& timers)
+{
+    return _pimpl->start(std::move(publisher), period, timers);
+}
+
+//==============================================================================
+void LatencyProbe::receive(
+        const xtypes::DynamicData& message)
+{
+    _pimpl->receive(message);
+}
+
+//==============================================================================
+LatencyProbe::Snapshot LatencyProbe::snapshot() const
+{
+    return _pimpl->snapshot();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
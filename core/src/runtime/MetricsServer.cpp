@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/MetricsServer.hpp>
+#include <is/utils/Log.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+#ifdef __linux__
+
+class MetricsServer::Implementation
+{
+public:
+
+    Implementation(
+            const std::string& address,
+            uint16_t port,
+            Render&& render)
+        : _address(address)
+        , _port(port)
+        , _render(std::move(render))
+        , _fd(-1)
+        , _stopped(false)
+        , _logger("is::core::MetricsServer")
+    {
+    }
+
+    ~Implementation()
+    {
+        stop();
+    }
+
+    bool start()
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(_port);
+        if (inet_pton(AF_INET, _address.c_str(), &addr.sin_addr) != 1)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Invalid address '" << _address << "' for the metrics listener." << std::endl;
+            return false;
+        }
+
+        _fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        const int reuse = 1;
+        if (_fd < 0
+                || setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0
+                || bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0
+                || listen(_fd, BACKLOG) != 0)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to listen for metrics scrapers on " << _address << ":" << _port
+                    << ": " << std::strerror(errno) << std::endl;
+            close_listener();
+            return false;
+        }
+
+        socklen_t length = sizeof(addr);
+        getsockname(_fd, reinterpret_cast<sockaddr*>(&addr), &length);
+        _port = ntohs(addr.sin_port);
+
+        _logger << utils::Logger::Level::INFO
+                << "Serving metrics on http://" << _address << ":" << _port << "/metrics" << std::endl;
+
+        _thread = std::thread(&Implementation::run, this);
+        return true;
+    }
+
+    uint16_t port() const
+    {
+        return _port;
+    }
+
+    void stop()
+    {
+        _stopped = true;
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+        close_listener();
+    }
+
+private:
+
+    static constexpr int BACKLOG = 16;
+
+    /**
+     * Maximum time that the listener waits before checking whether it must stop.
+     */
+    static constexpr int POLL_TIMEOUT_MS = 100;
+
+    /**
+     * Maximum size of the requests. Scrapers send small GET requests without body.
+     */
+    static constexpr std::size_t MAX_REQUEST = 8192;
+
+    void close_listener()
+    {
+        if (_fd >= 0)
+        {
+            close(_fd);
+            _fd = -1;
+        }
+    }
+
+    void run()
+    {
+        pollfd listener{_fd, POLLIN, 0};
+        while (!_stopped)
+        {
+            if (poll(&listener, 1, POLL_TIMEOUT_MS) <= 0)
+            {
+                continue;
+            }
+
+            const int client = accept4(_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client < 0)
+            {
+                continue;
+            }
+
+            serve(client);
+            close(client);
+        }
+    }
+
+    void serve(
+            int client)
+    {
+        /**
+         * A slow or idle client must not block the next scrapers for long.
+         */
+        timeval timeout{1, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST)
+        {
+            const ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+            {
+                return;
+            }
+            request.append(buffer, static_cast<std::size_t>(received));
+        }
+
+        const std::size_t line_end = request.find("\r\n");
+        const std::string line = request.substr(0, line_end);
+
+        if (line.rfind("GET /metrics ", 0) == 0 || line.rfind("GET /metrics?", 0) == 0)
+        {
+            respond(client, "200 OK", "text/plain; version=0.0.4; charset=utf-8", _render());
+        }
+        else if (line.rfind("GET ", 0) == 0)
+        {
+            respond(client, "404 Not Found", "text/plain; charset=utf-8", "Metrics are served under /metrics\n");
+        }
+        else
+        {
+            respond(client, "405 Method Not Allowed", "text/plain; charset=utf-8", "Only GET is supported\n");
+        }
+    }
+
+    void respond(
+            int client,
+            const std::string& status,
+            const std::string& content_type,
+            const std::string& body)
+    {
+        const std::string response =
+                "HTTP/1.1 " + status + "\r\n"
+                + "Content-Type: " + content_type + "\r\n"
+                + "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                + "Connection: close\r\n\r\n"
+                + body;
+
+        std::size_t sent = 0;
+        while (sent < response.size())
+        {
+            const ssize_t result = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0)
+            {
+                _logger << utils::Logger::Level::DEBUG
+                        << "Failed to send the metrics: " << std::strerror(errno) << std::endl;
+                return;
+            }
+            sent += static_cast<std::size_t>(result);
+        }
+    }
+
+    /**
+     * Class members.
+     */
+
+    const std::string _address;
+
+    uint16_t _port;
+
+    const Render _render;
+
+    int _fd;
+
+    std::atomic_bool _stopped;
+
+    std::thread _thread;
+
+    utils::Logger _logger;
+};
+
+#else
+
+class MetricsServer::Implementation
+{
+public:
+
+    Implementation(
+            const std::string&,
+            uint16_t,
+            Render&&)
+        : _logger("is::core::MetricsServer")
+    {
+    }
+
+    bool start()
+    {
+        _logger << utils::Logger::Level::ERROR
+                << "The metrics listener is only available on Linux." << std::endl;
+        return false;
+    }
+
+    uint16_t port() const
+    {
+        return 0;
+    }
+
+    void stop()
+    {
+    }
+
+private:
+
+    utils::Logger _logger;
+};
+
+#endif //  __linux__
+
+//==============================================================================
+MetricsServer::MetricsServer(
+        const std::string& address,
+        uint16_t port,
+        Render render)
+    : _pimpl(new Implementation(address, port, std::move(render)))
+{
+}
+
+//==============================================================================
+MetricsServer::~MetricsServer()
+{
+    _pimpl.reset();
+}
+
+//==============================================================================
+bool MetricsServer::start()
+{
+    return _pimpl->start();
+}
+
+//==============================================================================
+uint16_t MetricsServer::port() const
+{
+    return _pimpl->port();
+}
+
+//==============================================================================
+void MetricsServer::stop()
+{
+    _pimpl->stop();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/Reactor.hpp>
+#include <is/utils/Log.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+#ifdef __linux__
+
+class Reactor::Implementation
+{
+public:
+
+    Implementation()
+        : _epoll_fd(epoll_create1(EPOLL_CLOEXEC))
+        , _wake_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+        , _logger("is::core::Reactor")
+    {
+        if (_epoll_fd < 0 || _wake_fd < 0)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to create the reactor: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = WAKE_UP;
+        epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wake_fd, &event);
+    }
+
+    ~Implementation()
+    {
+        if (_wake_fd >= 0)
+        {
+            close(_wake_fd);
+        }
+
+        if (_epoll_fd >= 0)
+        {
+            close(_epoll_fd);
+        }
+    }
+
+    bool add(
+            int fd,
+            Handler&& handler)
+    {
+        if (_epoll_fd < 0 || fd < 0)
+        {
+            return false;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = _handlers.size();
+
+        if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to watch the file descriptor " << fd << ": "
+                    << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        _handlers.emplace_back(std::move(handler));
+        return true;
+    }
+
+    bool run_once(
+            std::chrono::milliseconds timeout)
+    {
+        if (_epoll_fd < 0)
+        {
+            return false;
+        }
+
+        epoll_event events[MAX_EVENTS];
+        const int ready = epoll_wait(_epoll_fd, events, MAX_EVENTS, static_cast<int>(timeout.count()));
+
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                return true;
+            }
+
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to wait for events: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        bool okay = true;
+        for (int i = 0; i < ready; ++i)
+        {
+            if (events[i].data.u64 == WAKE_UP)
+            {
+                uint64_t count;
+                while (read(_wake_fd, &count, sizeof(count)) > 0)
+                {
+                }
+                continue;
+            }
+
+            okay &= _handlers[events[i].data.u64]();
+        }
+
+        return okay;
+    }
+
+    void wake_up()
+    {
+        const uint64_t one = 1;
+        if (_wake_fd >= 0 && write(_wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        {
+            _logger << utils::Logger::Level::WARN
+                    << "Failed to wake up the reactor: " << std::strerror(errno) << std::endl;
+        }
+    }
+
+    std::size_t size() const
+    {
+        return _handlers.size();
+    }
+
+    int wait_handle() const
+    {
+        return _epoll_fd;
+    }
+
+private:
+
+    static constexpr uint64_t WAKE_UP = std::numeric_limits<uint64_t>::max();
+
+    static constexpr int MAX_EVENTS = 32;
+
+    /**
+     * Class members.
+     */
+
+    const int _epoll_fd;
+
+    const int _wake_fd;
+
+    std::vector<Handler> _handlers;
+
+    utils::Logger _logger;
+};
+
+#else
+
+/**
+ * Placeholder implementation for platforms without `epoll`. Nothing can be watched.
+ */
+class Reactor::Implementation
+{
+public:
+
+    bool add(
+            int,
+            Handler&&)
+    {
+        return false;
+    }
+
+    bool run_once(
+            std::chrono::milliseconds)
+    {
+        return false;
+    }
+
+    void wake_up()
+    {
+    }
+
+    std::size_t size() const
+    {
+        return 0;
+    }
+
+    int wait_handle() const
+    {
+        return -1;
+    }
+
+};
+
+#endif //  __linux__
+
+//==============================================================================
+Reactor::Reactor()
+    : _pimpl(new Implementation())
+{
+}
+
+//==============================================================================
+Reactor::~Reactor()
+{
+    _pimpl.reset();
+}
+
+//==============================================================================
+bool Reactor::add(
+        int fd,
+        Handler handler)
+{
+    return _pimpl->add(fd, std::move(handler));
+}
+
+//==============================================================================
+bool Reactor::run_once(
+        std::chrono::milliseconds timeout)
+{
+    return _pimpl->run_once(timeout);
+}
+
+//==============================================================================
+void Reactor::wake_up()
+{
+    _pimpl->wake_up();
+}
+
+//==============================================================================
+std::size_t Reactor::size() const
+{
+    return _pimpl->size();
+}
+
+//==============================================================================
+int Reactor::wait_handle() const
+{
+    return _pimpl->wait_handle();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
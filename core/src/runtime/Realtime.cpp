@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/Realtime.hpp>
+#include <is/utils/Log.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <alloca.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+#ifdef __linux__
+
+//==============================================================================
+void touch_pages(
+        volatile unsigned char* memory,
+        std::size_t size)
+{
+    const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    for (std::size_t i = 0; i < size; i += page_size)
+    {
+        memory[i] = 0;
+    }
+}
+
+//==============================================================================
+__attribute__((noinline)) void touch_stack(
+        std::size_t size)
+{
+    touch_pages(static_cast<volatile unsigned char*>(alloca(size)), size);
+}
+
+/**
+ * Stack kept free below the prefaulted region, for the frames of the functions doing the prefault.
+ */
+constexpr std::size_t STACK_SAFETY_MARGIN = 64 * 1024;
+
+//==============================================================================
+std::size_t remaining_stack()
+{
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+    {
+        return 0;
+    }
+
+    void* stack_base = nullptr;
+    std::size_t stack_size = 0;
+    const int result = pthread_attr_getstack(&attributes, &stack_base, &stack_size);
+    pthread_attr_destroy(&attributes);
+    if (result != 0)
+    {
+        return 0;
+    }
+
+    /**
+     * The stack grows downwards, from the top of the region towards its base.
+     */
+    const unsigned char marker = 0;
+    const auto used_end = reinterpret_cast<std::uintptr_t>(&marker);
+    const auto base = reinterpret_cast<std::uintptr_t>(stack_base);
+    if (used_end <= base + STACK_SAFETY_MARGIN)
+    {
+        return 0;
+    }
+
+    return used_end - base - STACK_SAFETY_MARGIN;
+}
+
+#endif //  __linux__
+
+} //  anonymous namespace
+
+//==============================================================================
+bool RealtimeSettings::apply_to_process() const
+{
+#ifdef __linux__
+    utils::Logger logger("is::core::Realtime");
+
+    if (lock_memory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        logger << utils::Logger::Level::ERROR
+               << "Could not lock the memory of the process: " << std::strerror(errno)
+               << ". Check the RLIMIT_MEMLOCK limit, or the CAP_IPC_LOCK capability." << std::endl;
+        return false;
+    }
+
+    if (prefault_heap > 0)
+    {
+#ifdef __GLIBC__
+        /**
+         * Keeps the freed memory in the process, instead of giving it back to the system,
+         * and serves every allocation from the already faulted heap.
+         */
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+#endif //  __GLIBC__
+
+        void* heap = std::malloc(prefault_heap);
+        if (heap == nullptr)
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not reserve " << prefault_heap << " bytes of heap." << std::endl;
+            return false;
+        }
+
+        touch_pages(static_cast<volatile unsigned char*>(heap), prefault_heap);
+        std::free(heap);
+    }
+
+    logger << utils::Logger::Level::INFO
+           << "Real-time mode enabled" << (lock_memory ? ", with the memory locked" : "")
+           << "." << std::endl;
+    return true;
+#else
+    utils::Logger logger("is::core::Realtime");
+    logger << utils::Logger::Level::ERROR
+           << "The real-time mode is only supported on Linux." << std::endl;
+    return false;
+#endif //  __linux__
+}
+
+//==============================================================================
+void RealtimeSettings::prefault_current_stack() const
+{
+#ifdef __linux__
+    if (prefault_stack == 0)
+    {
+        return;
+    }
+
+    const std::size_t available = remaining_stack();
+    if (prefault_stack > available)
+    {
+        utils::Logger logger("is::core::Realtime");
+        logger << utils::Logger::Level::WARN
+               << "The stack to prefault (" << prefault_stack << " bytes) does not fit in the stack of the thread; "
+               << "only " << available << " bytes will be prefaulted." << std::endl;
+    }
+
+    const std::size_t size = std::min(prefault_stack, available);
+    if (size > 0)
+    {
+        touch_stack(size);
+    }
+#endif //  __linux__
+}
+
+//==============================================================================
+PageFaultMonitor::PageFaultMonitor()
+    : _last(0)
+{
+    poll();
+}
+
+//==============================================================================
+uint64_t PageFaultMonitor::poll()
+{
+#ifdef __linux__
+    rusage usage;
+    if (getrusage(RUSAGE_THREAD, &usage) != 0)
+    {
+        return 0;
+    }
+
+    const uint64_t total = static_cast<uint64_t>(usage.ru_minflt) + static_cast<uint64_t>(usage.ru_majflt);
+    const uint64_t faults = total - _last;
+    _last = total;
+    return faults;
+#else
+    return 0;
+#endif //  __linux__
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
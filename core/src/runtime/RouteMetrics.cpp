@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/RouteMetrics.hpp>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+//==============================================================================
+RouteMetrics::RouteMetrics()
+{
+}
+
+//==============================================================================
+RouteMetrics::Snapshot RouteMetrics::snapshot() const
+{
+    Snapshot snapshot;
+    for (const Stripe& stripe : _stripes)
+    {
+        snapshot.messages += stripe.messages.load(std::memory_order_relaxed);
+        snapshot.dropped += stripe.dropped.load(std::memory_order_relaxed);
+    }
+
+    snapshot.conversion = _conversion.snapshot();
+    snapshot.publish = _publish.snapshot();
+    return snapshot;
+}
+
+//==============================================================================
+std::size_t RouteMetrics::stripe_index()
+{
+    static std::atomic<std::size_t> next_stripe(0);
+    thread_local const std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % STRIPES;
+    return stripe;
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ServiceBatcher.hpp>
+#include <is/utils/Log.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+class ServiceBatcher::Implementation : public std::enable_shared_from_this<Implementation>
+{
+public:
+
+    Implementation(
+            const std::string& service_name,
+            const Policy& policy,
+            std::shared_ptr<ServiceProvider> provider,
+            TimerQueue& timers)
+        : _service_name(service_name)
+        , _policy(policy)
+        , _provider(std::move(provider))
+        , _timers(timers)
+        , _generation(0)
+        , _logger("is::core::ServiceBatcher")
+    {
+        _batch.reserve(_policy.max_size);
+    }
+
+    void add(
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle)
+    {
+        std::vector<ServiceProvider::Request> full_batch;
+        bool open_window = false;
+        uint64_t generation;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _batch.push_back(ServiceProvider::Request{request, &client, std::move(call_handle)});
+            open_window = (_batch.size() == 1);
+            generation = _generation;
+
+            if (_batch.size() >= _policy.max_size)
+            {
+                full_batch = take_batch();
+                open_window = false;
+            }
+        }
+
+        if (!full_batch.empty())
+        {
+            send(full_batch);
+            return;
+        }
+
+        if (open_window)
+        {
+            std::weak_ptr<Implementation> weak_self = shared_from_this();
+            const bool scheduled = _timers.schedule_after(
+                _policy.window,
+                [weak_self, generation]()
+                {
+                    if (auto self = weak_self.lock())
+                    {
+                        self->expire(generation);
+                    }
+                });
+
+            /**
+             * Once the timers have been stopped no window will ever expire,
+             * so the request is sent right away instead.
+             */
+            if (!scheduled)
+            {
+                expire(generation);
+            }
+        }
+    }
+
+    void flush()
+    {
+        std::vector<ServiceProvider::Request> batch;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_batch.empty())
+            {
+                return;
+            }
+
+            batch = take_batch();
+        }
+
+        send(batch);
+    }
+
+private:
+
+    /**
+     * Must be called with the mutex locked.
+     */
+    std::vector<ServiceProvider::Request> take_batch()
+    {
+        std::vector<ServiceProvider::Request> batch;
+        batch.reserve(_policy.max_size);
+        std::swap(batch, _batch);
+        ++_generation;
+        return batch;
+    }
+
+    void expire(
+            uint64_t generation)
+    {
+        std::vector<ServiceProvider::Request> batch;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            /**
+             * The batch that opened this window may have already been sent, because it got full.
+             */
+            if (generation != _generation || _batch.empty())
+            {
+                return;
+            }
+
+            batch = take_batch();
+        }
+
+        send(batch);
+    }
+
+    void send(
+            const std::vector<ServiceProvider::Request>& batch)
+    {
+        _logger << utils::Logger::Level::DEBUG
+                << "Sending a batch of " << batch.size() << " requests for the service '"
+                << _service_name << "'." << std::endl;
+
+        try
+        {
+            _provider->call_service_batch(batch);
+        }
+        catch (const std::exception& e)
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Failed to send a batch of " << batch.size() << " requests for the service '"
+                    << _service_name << "': " << e.what() << std::endl;
+        }
+    }
+
+    /**
+     * Class members.
+     */
+
+    const std::string _service_name;
+
+    Policy _policy;
+
+    std::shared_ptr<ServiceProvider> _provider;
+
+    TimerQueue& _timers;
+
+    std::mutex _mutex;
+
+    std::vector<ServiceProvider::Request> _batch;
+
+    uint64_t _generation;
+
+    utils::Logger _logger;
+};
+
+//==============================================================================
+ServiceBatcher::ServiceBatcher(
+        const std::string& service_name,
+        const Policy& policy,
+        std::shared_ptr<ServiceProvider> provider,
+        TimerQueue& timers)
+    : _pimpl(std::make_shared<Implementation>(service_name, policy, std::move(provider), timers))
+{
+}
+
+//==============================================================================
+void ServiceBatcher::call_service(
+        const xtypes::DynamicData& request,
+        ServiceClient& client,
+        std::shared_ptr<void> call_handle)
+{
+    _pimpl->add(request, client, std::move(call_handle));
+}
+
+//==============================================================================
+void ServiceBatcher::flush()
+{
+    _pimpl->flush();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ServiceCallTracker.hpp>
+#include <is/utils/Tracepoint.hpp>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+//==============================================================================
+/**
+ * @brief Call handle given to the ServiceProvider, which remembers the original client of the call
+ *        and stops counting it once finished.
+ */
+struct TrackedCall
+{
+    TrackedCall(
+            ServiceClient& client_,
+            std::shared_ptr<void> call_handle_,
+            std::shared_ptr<std::atomic<int64_t> > in_flight_,
+            std::function<void()> on_response_)
+        : client(client_)
+        , call_handle(std::move(call_handle_))
+        , in_flight(std::move(in_flight_))
+        , on_response(std::move(on_response_))
+        , finished(false)
+    {
+        in_flight->fetch_add(1);
+    }
+
+    TrackedCall(
+            const TrackedCall& /*other*/) = delete;
+
+    ~TrackedCall()
+    {
+        finish();
+    }
+
+    /**
+     * Hedged calls may be answered more than once, but they are only counted once.
+     * Returns whether this was the first time that the call finished.
+     */
+    bool finish()
+    {
+        if (finished.exchange(true))
+        {
+            return false;
+        }
+
+        in_flight->fetch_sub(1);
+        return true;
+    }
+
+    ServiceClient& client;
+    std::shared_ptr<void> call_handle;
+    std::shared_ptr<std::atomic<int64_t> > in_flight;
+    std::function<void()> on_response;
+    std::atomic_bool finished;
+};
+
+} //  anonymous namespace
+
+//==============================================================================
+ServiceCallTracker::ServiceCallTracker(
+        std::shared_ptr<std::atomic<int64_t> > in_flight)
+    : _in_flight(std::move(in_flight))
+{
+}
+
+//==============================================================================
+std::shared_ptr<void> ServiceCallTracker::wrap(
+        ServiceClient& client,
+        std::shared_ptr<void> call_handle,
+        std::function<void()> on_response) const
+{
+    return std::make_shared<TrackedCall>(client, std::move(call_handle), _in_flight, std::move(on_response));
+}
+
+//==============================================================================
+void ServiceCallTracker::receive_response(
+        std::shared_ptr<void> call_handle,
+        const xtypes::DynamicData& response)
+{
+    /**
+     * This proxy is only ever given to the provider along with the handles created by `wrap()`.
+     */
+    const auto call = std::static_pointer_cast<TrackedCall>(call_handle);
+    IS_TRACEPOINT(service_response, call.get());
+
+    call->client.receive_response(call->call_handle, response);
+    if (call->finish() && call->on_response)
+    {
+        call->on_response();
+    }
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
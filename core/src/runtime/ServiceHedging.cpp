@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ServiceHedging.hpp>
+#include <is/utils/Log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+class ServiceHedging::Implementation
+{
+public:
+
+    Implementation(
+            const std::string& service_name,
+            const Policy& policy,
+            TimerQueue& timers)
+        : _service_name(service_name)
+        , _policy(policy)
+        , _timers(timers)
+        , _samples(std::max<std::size_t>(policy.window, 1), 0)
+        , _next_sample(0)
+        , _sample_count(0)
+        , _delay_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::max(policy.initial_delay, policy.min_delay)).count())
+        , _requests(0)
+        , _hedged(0)
+        , _hedge_wins(0)
+        , _logger("is::core::ServiceHedging")
+    {
+    }
+
+    void record_latency(
+            std::chrono::nanoseconds latency)
+    {
+        std::unique_lock<std::mutex> lock(_samples_mutex);
+
+        _samples[_next_sample] = latency.count();
+        _next_sample = (_next_sample + 1) % _samples.size();
+        ++_sample_count;
+
+        /**
+         * Computing the percentile is O(n), so it is only refreshed every time
+         * an eighth of the window has been renewed.
+         */
+        const std::size_t refresh_every = std::max<std::size_t>(_samples.size() / 8, 1);
+        if (_sample_count < _policy.min_samples || _sample_count % refresh_every != 0)
+        {
+            return;
+        }
+
+        const std::size_t valid = std::min(_sample_count, _samples.size());
+        std::vector<int64_t> sorted(_samples.begin(), _samples.begin() + valid);
+
+        const std::size_t rank = static_cast<std::size_t>(
+            std::ceil(_policy.percentile / 100.0 * static_cast<double>(valid)));
+        const std::size_t index = std::min(std::max<std::size_t>(rank, 1), valid) - 1;
+
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+
+        const int64_t min_delay =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(_policy.min_delay).count();
+        _delay_ns = std::max(sorted[index], min_delay);
+    }
+
+    std::chrono::nanoseconds hedge_delay() const
+    {
+        return std::chrono::nanoseconds(_delay_ns.load());
+    }
+
+    Statistics statistics() const
+    {
+        return Statistics{_requests.load(), _hedged.load(), _hedge_wins.load()};
+    }
+
+    void count_request()
+    {
+        ++_requests;
+    }
+
+    void count_hedged()
+    {
+        ++_hedged;
+    }
+
+    void count_hedge_win()
+    {
+        ++_hedge_wins;
+    }
+
+    TimerQueue& timers()
+    {
+        return _timers;
+    }
+
+    const std::string& service_name() const
+    {
+        return _service_name;
+    }
+
+    utils::Logger& logger()
+    {
+        return _logger;
+    }
+
+private:
+
+    /**
+     * Class members.
+     */
+
+    const std::string _service_name;
+
+    const Policy _policy;
+
+    TimerQueue& _timers;
+
+    std::mutex _samples_mutex;
+
+    std::vector<int64_t> _samples;
+
+    std::size_t _next_sample;
+
+    std::size_t _sample_count;
+
+    std::atomic<int64_t> _delay_ns;
+
+    std::atomic<uint64_t> _requests;
+
+    std::atomic<uint64_t> _hedged;
+
+    std::atomic<uint64_t> _hedge_wins;
+
+    utils::Logger _logger;
+};
+
+namespace {
+
+//==============================================================================
+/**
+ * @brief ServiceClient proxy given to the ServiceProvider in place of the real client.
+ *
+ *        Every request sent to the provider (the original one and the hedged one)
+ *        gets its own Attempt handle, so that the latency of each one can be measured
+ *        independently. Only the first response is forwarded to the real client.
+ */
+class HedgedCall
+    : public ServiceClient
+    , public std::enable_shared_from_this<HedgedCall>
+{
+public:
+
+    struct Attempt
+    {
+        std::shared_ptr<HedgedCall> call;
+        TimerQueue::Clock::time_point start;
+        bool hedged;
+    };
+
+    HedgedCall(
+            std::shared_ptr<ServiceHedging::Implementation> hedging,
+            std::shared_ptr<ServiceProvider> provider,
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle)
+        : _hedging(std::move(hedging))
+        , _provider(std::move(provider))
+        , _request(request)
+        , _client(client)
+        , _call_handle(std::move(call_handle))
+        , _answered(false)
+    {
+    }
+
+    void attempt(
+            bool hedged)
+    {
+        auto handle = std::make_shared<Attempt>(
+            Attempt{shared_from_this(), TimerQueue::Clock::now(), hedged});
+
+        _provider->call_service(_request, *this, std::move(handle));
+    }
+
+    void receive_response(
+            std::shared_ptr<void> call_handle,
+            const xtypes::DynamicData& response) override
+    {
+        /**
+         * This proxy is only ever given to the provider along with its own Attempt handles.
+         */
+        const auto attempt = std::static_pointer_cast<Attempt>(call_handle);
+        _hedging->record_latency(TimerQueue::Clock::now() - attempt->start);
+
+        if (_answered.exchange(true))
+        {
+            return;
+        }
+
+        if (attempt->hedged)
+        {
+            _hedging->count_hedge_win();
+        }
+
+        _client.receive_response(_call_handle, response);
+    }
+
+    bool answered() const
+    {
+        return _answered;
+    }
+
+private:
+
+    std::shared_ptr<ServiceHedging::Implementation> _hedging;
+
+    std::shared_ptr<ServiceProvider> _provider;
+
+    const xtypes::DynamicData _request;
+
+    ServiceClient& _client;
+
+    std::shared_ptr<void> _call_handle;
+
+    std::atomic_bool _answered;
+};
+
+} //  anonymous namespace
+
+//==============================================================================
+ServiceHedging::ServiceHedging(
+        const std::string& service_name,
+        const Policy& policy,
+        TimerQueue& timers)
+    : _pimpl(std::make_shared<Implementation>(service_name, policy, timers))
+{
+}
+
+//==============================================================================
+void ServiceHedging::call_service(
+        const std::shared_ptr<ServiceProvider>& provider,
+        const xtypes::DynamicData& request,
+        ServiceClient& client,
+        std::shared_ptr<void> call_handle)
+{
+    _pimpl->count_request();
+
+    auto call = std::make_shared<HedgedCall>(
+        _pimpl, provider, request, client, std::move(call_handle));
+
+    call->attempt(false);
+
+    /**
+     * Providers may answer synchronously from `call_service`, in which case
+     * there is nothing left to hedge.
+     */
+    if (call->answered())
+    {
+        return;
+    }
+
+    std::shared_ptr<Implementation> hedging = _pimpl;
+    hedging->timers().schedule_after(
+        hedging->hedge_delay(),
+        [hedging, call]()
+        {
+            if (call->answered())
+            {
+                return;
+            }
+
+            hedging->count_hedged();
+
+            hedging->logger() << utils::Logger::Level::DEBUG
+                              << "Sending a hedged request for the service '"
+                              << hedging->service_name() << "' after "
+                              << hedging->hedge_delay().count() << " ns without response."
+                              << std::endl;
+
+            try
+            {
+                call->attempt(true);
+            }
+            catch (const std::exception& e)
+            {
+                hedging->logger() << utils::Logger::Level::ERROR
+                                  << "The hedged request for the service '"
+                                  << hedging->service_name() << "' failed: "
+                                  << e.what() << std::endl;
+            }
+        });
+}
+
+//==============================================================================
+std::chrono::nanoseconds ServiceHedging::hedge_delay() const
+{
+    return _pimpl->hedge_delay();
+}
+
+//==============================================================================
+ServiceHedging::Statistics ServiceHedging::statistics() const
+{
+    return _pimpl->statistics();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
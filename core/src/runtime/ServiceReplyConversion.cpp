@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ServiceReplyConversion.hpp>
+#include <is/utils/Profiler.hpp>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+//==============================================================================
+/**
+ * @brief Call handle given to the ServiceProvider, which remembers the original client of the call.
+ */
+struct ConvertingCall
+{
+    ServiceClient& client;
+    std::shared_ptr<void> call_handle;
+};
+
+} //  anonymous namespace
+
+//==============================================================================
+ServiceReplyConversion::ServiceReplyConversion(
+        const xtypes::DynamicType& client_reply_type)
+    : _client_reply_type(client_reply_type)
+{
+}
+
+//==============================================================================
+std::shared_ptr<void> ServiceReplyConversion::wrap(
+        ServiceClient& client,
+        std::shared_ptr<void> call_handle) const
+{
+    return std::make_shared<ConvertingCall>(ConvertingCall{client, std::move(call_handle)});
+}
+
+//==============================================================================
+void ServiceReplyConversion::receive_response(
+        std::shared_ptr<void> call_handle,
+        const xtypes::DynamicData& response)
+{
+    /**
+     * This proxy is only ever given to the provider along with the handles created by `wrap()`.
+     */
+    const auto call = std::static_pointer_cast<ConvertingCall>(call_handle);
+
+    const utils::Profiler::Scope profile("conversion", response.type().name(), _client_reply_type.name());
+    const xtypes::DynamicData compatible_response(response, _client_reply_type);
+    call->client.receive_response(call->call_handle, compatible_response);
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
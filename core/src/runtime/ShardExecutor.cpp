@@ -0,0 +1,435 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ShardExecutor.hpp>
+#include <is/utils/SpscQueue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+/**
+ * Identifies each executor, so that the producer queues cached by the threads
+ * are never mistaken for those of an executor created later at the same address.
+ */
+std::atomic<uint64_t> next_executor_id(0);
+
+/**
+ * Maximum time that an idle shard sleeps before checking its queues again.
+ */
+constexpr std::chrono::milliseconds IDLE_WAIT{1};
+
+/**
+ * Whether the calling thread is the thread of a shard, of any executor.
+ */
+thread_local bool on_shard_thread = false;
+
+} //  anonymous namespace
+
+class ShardExecutor::Implementation
+{
+public:
+
+    Implementation(
+            const std::vector<ThreadSettings>& shards,
+            std::size_t queue_capacity)
+        : _id(next_executor_id++)
+        , _queue_capacity(queue_capacity)
+        , _stopped(false)
+    {
+        _shards.reserve(shards.size());
+        for (const ThreadSettings& settings : shards)
+        {
+            _shards.emplace_back(new Shard(settings));
+        }
+
+        for (const auto& shard : _shards)
+        {
+            Shard* const raw_shard = shard.get();
+            shard->thread = std::thread([this, raw_shard]()
+                            {
+                                run(*raw_shard);
+                            });
+        }
+    }
+
+    ~Implementation()
+    {
+        stop();
+    }
+
+    std::size_t size() const
+    {
+        return _shards.size();
+    }
+
+    std::size_t shard_of(
+            const std::string& route) const
+    {
+        return std::hash<std::string>()(route) % _shards.size();
+    }
+
+    bool post(
+            std::size_t shard_index,
+            Task&& task)
+    {
+        if (_stopped)
+        {
+            return false;
+        }
+
+        Shard& shard = *_shards[shard_index];
+        Inbox& inbox = producer_inbox(shard_index);
+
+        /**
+         * The task is counted before it can be popped, so that the depth never goes below zero.
+         */
+        shard.depth.fetch_add(1, std::memory_order_relaxed);
+
+        /**
+         * A shard whose task hands a message over to another shard cannot wait for it to make room:
+         * if the other one was waiting for it as well, neither would ever run again.
+         */
+        while (!inbox.tasks.try_push(std::move(task)))
+        {
+            if (_stopped || on_shard_thread)
+            {
+                shard.depth.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
+
+        /**
+         * Pairs with the fence of the shard once it announces that it goes to sleep:
+         * either the shard sees this task, or this thread sees the shard sleeping.
+         */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (shard.sleeping.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.cv.notify_one();
+        }
+
+        return true;
+    }
+
+    std::vector<std::size_t> queue_depths() const
+    {
+        std::vector<std::size_t> depths;
+        depths.reserve(_shards.size());
+        for (const auto& shard : _shards)
+        {
+            depths.push_back(shard->depth.load(std::memory_order_relaxed));
+        }
+        return depths;
+    }
+
+    void stop()
+    {
+        if (_stopped.exchange(true))
+        {
+            return;
+        }
+
+        for (const auto& shard : _shards)
+        {
+            {
+                std::unique_lock<std::mutex> lock(shard->mutex);
+            }
+            shard->cv.notify_one();
+
+            if (shard->thread.joinable())
+            {
+                shard->thread.join();
+            }
+        }
+    }
+
+private:
+
+    /**
+     * Queue from a producer thread towards a shard. Once its thread has finished,
+     * the shard drops it as soon as it has executed the tasks left in it.
+     */
+    struct Inbox
+    {
+        Inbox(
+                std::size_t capacity)
+            : tasks(capacity)
+        {
+        }
+
+        utils::SpscQueue<Task> tasks;
+        std::atomic_bool closed{false};
+    };
+
+    /**
+     * Queues of a producer thread, per executor and shard. They get closed when the thread finishes.
+     */
+    struct ProducerInboxes
+    {
+        ~ProducerInboxes()
+        {
+            for (const auto& [executor, inboxes] : by_executor)
+            {
+                for (const auto& inbox : inboxes)
+                {
+                    if (inbox)
+                    {
+                        inbox->closed.store(true, std::memory_order_release);
+                    }
+                }
+            }
+        }
+
+        std::unordered_map<uint64_t, std::vector<std::shared_ptr<Inbox> > > by_executor;
+    };
+
+    struct Shard
+    {
+        Shard(
+                const ThreadSettings& settings_)
+            : settings(settings_)
+            , inboxes_version(0)
+            , depth(0)
+            , sleeping(false)
+        {
+        }
+
+        ThreadSettings settings;
+
+        std::mutex mutex;
+
+        std::condition_variable cv;
+
+        std::vector<std::shared_ptr<Inbox> > inboxes;
+
+        std::atomic<uint64_t> inboxes_version;
+
+        /**
+         * Tasks handed over to the shard and not executed yet.
+         */
+        std::atomic<std::size_t> depth;
+
+        std::atomic_bool sleeping;
+
+        std::thread thread;
+    };
+
+    /**
+     * Gets the queue from the calling thread towards a shard, creating it on first use.
+     */
+    Inbox& producer_inbox(
+            std::size_t shard_index)
+    {
+        thread_local ProducerInboxes producer_inboxes;
+
+        std::vector<std::shared_ptr<Inbox> >& inboxes = producer_inboxes.by_executor[_id];
+        if (inboxes.empty())
+        {
+            inboxes.resize(_shards.size());
+        }
+
+        std::shared_ptr<Inbox>& inbox = inboxes[shard_index];
+        if (!inbox)
+        {
+            inbox = std::make_shared<Inbox>(_queue_capacity);
+
+            Shard& shard = *_shards[shard_index];
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.inboxes.push_back(inbox);
+            ++shard.inboxes_version;
+        }
+
+        return *inbox;
+    }
+
+    void run(
+            Shard& shard)
+    {
+        shard.settings.apply();
+        on_shard_thread = true;
+
+        std::vector<std::shared_ptr<Inbox> > inboxes;
+        uint64_t inboxes_version = 0;
+        Task task;
+
+        const auto pending = [&]()
+                {
+                    for (const auto& inbox : inboxes)
+                    {
+                        if (!inbox->tasks.empty())
+                        {
+                            return true;
+                        }
+                    }
+                    return shard.inboxes_version.load() != inboxes_version;
+                };
+
+        while (true)
+        {
+            if (shard.inboxes_version.load() != inboxes_version)
+            {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                inboxes = shard.inboxes;
+                inboxes_version = shard.inboxes_version.load();
+            }
+
+            /**
+             * Each queue gets at most a batch of its size per turn, so that a busy producer
+             * cannot starve the rest.
+             */
+            bool worked = false;
+            bool finished_producers = false;
+            for (const auto& inbox : inboxes)
+            {
+                /**
+                 * A closed queue gets no more tasks, so once seen empty it can be dropped.
+                 */
+                const bool closed = inbox->closed.load(std::memory_order_acquire);
+                for (std::size_t i = 0; i < _queue_capacity && inbox->tasks.try_pop(task); ++i)
+                {
+                    shard.depth.fetch_sub(1, std::memory_order_relaxed);
+                    task();
+                    task = nullptr;
+                    worked = true;
+                }
+                finished_producers |= closed && inbox->tasks.empty();
+            }
+
+            if (finished_producers)
+            {
+                retire_finished_producers(shard);
+            }
+
+            if (worked)
+            {
+                continue;
+            }
+
+            /**
+             * The shard only finishes once the tasks handed over before stopping have been executed.
+             */
+            if (_stopped)
+            {
+                break;
+            }
+
+            shard.sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                if (!pending() && !_stopped)
+                {
+                    shard.cv.wait_for(lock, IDLE_WAIT);
+                }
+            }
+            shard.sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Drops the queues of the producer threads that have finished, once they are empty.
+     */
+    void retire_finished_producers(
+            Shard& shard)
+    {
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        const auto finished = std::remove_if(shard.inboxes.begin(), shard.inboxes.end(),
+                        [](const std::shared_ptr<Inbox>& inbox)
+                        {
+                            return inbox->closed.load(std::memory_order_acquire) && inbox->tasks.empty();
+                        });
+        shard.inboxes.erase(finished, shard.inboxes.end());
+        ++shard.inboxes_version;
+    }
+
+    /**
+     * Class members.
+     */
+
+    const uint64_t _id;
+
+    const std::size_t _queue_capacity;
+
+    std::vector<std::unique_ptr<Shard> > _shards;
+
+    std::atomic_bool _stopped;
+};
+
+//==============================================================================
+ShardExecutor::ShardExecutor(
+        const std::vector<ThreadSettings>& shards,
+        std::size_t queue_capacity)
+    : _pimpl(new Implementation(shards, queue_capacity))
+{
+}
+
+//==============================================================================
+ShardExecutor::~ShardExecutor()
+{
+    stop();
+}
+
+//==============================================================================
+std::size_t ShardExecutor::size() const
+{
+    return _pimpl->size();
+}
+
+//==============================================================================
+std::size_t ShardExecutor::shard_of(
+        const std::string& route) const
+{
+    return _pimpl->shard_of(route);
+}
+
+//==============================================================================
+bool ShardExecutor::post(
+        std::size_t shard,
+        Task task)
+{
+    return _pimpl->post(shard, std::move(task));
+}
+
+//==============================================================================
+std::vector<std::size_t> ShardExecutor::queue_depths() const
+{
+    return _pimpl->queue_depths();
+}
+
+//==============================================================================
+void ShardExecutor::stop()
+{
+    _pimpl->stop();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/SpinPolicy.hpp>
+
+#include <algorithm>
+#include <map>
+#include <thread>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+/**
+ * Number of idle spins polling right away, and then yielding, before the adaptive backoff starts sleeping.
+ */
+constexpr uint32_t BACKOFF_POLL_SPINS = 64;
+constexpr uint32_t BACKOFF_YIELD_SPINS = 128;
+
+} //  anonymous namespace
+
+//==============================================================================
+bool SpinPolicy::kind_from_string(
+        const std::string& name,
+        Kind& kind)
+{
+    static const std::map<std::string, Kind> kinds = {
+        {"busy_poll", Kind::BUSY_POLL},
+        {"yield", Kind::YIELD},
+        {"adaptive_backoff", Kind::ADAPTIVE_BACKOFF},
+        {"blocking", Kind::BLOCKING}
+    };
+
+    const auto it = kinds.find(name);
+    if (it == kinds.end())
+    {
+        return false;
+    }
+
+    kind = it->second;
+    return true;
+}
+
+//==============================================================================
+SpinStrategy::SpinStrategy(
+        const SpinPolicy& policy,
+        std::vector<int> wait_handles)
+    : _policy(policy)
+    , _idle_spins(0)
+    , _backoff(1)
+{
+#ifdef __linux__
+    _poll_fds.reserve(wait_handles.size());
+    for (const int wait_handle : wait_handles)
+    {
+        _poll_fds.push_back(pollfd{wait_handle, POLLIN, 0});
+    }
+#else
+    static_cast<void>(wait_handles);
+#endif //  __linux__
+}
+
+//==============================================================================
+void SpinStrategy::worked()
+{
+    _idle_spins = 0;
+    _backoff = std::chrono::microseconds(1);
+}
+
+//==============================================================================
+void SpinStrategy::idle()
+{
+    switch (_policy.kind)
+    {
+        case SpinPolicy::Kind::BUSY_POLL:
+        {
+            break;
+        }
+        case SpinPolicy::Kind::YIELD:
+        {
+            std::this_thread::yield();
+            break;
+        }
+        case SpinPolicy::Kind::ADAPTIVE_BACKOFF:
+        {
+            if (_idle_spins < BACKOFF_POLL_SPINS)
+            {
+                ++_idle_spins;
+            }
+            else if (_idle_spins < BACKOFF_YIELD_SPINS)
+            {
+                ++_idle_spins;
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(_backoff);
+                _backoff = std::min(_backoff * 2, _policy.max_backoff);
+            }
+            break;
+        }
+        case SpinPolicy::Kind::BLOCKING:
+        {
+#ifdef __linux__
+            if (!_poll_fds.empty())
+            {
+                /**
+                 * The timeout of `poll` is given in milliseconds, so it is rounded up,
+                 * since truncating a shorter one to zero would busy poll.
+                 */
+                poll(_poll_fds.data(), _poll_fds.size(), static_cast<int>(
+                        std::chrono::ceil<std::chrono::milliseconds>(_policy.block_timeout).count()));
+                break;
+            }
+#endif //  __linux__
+            std::this_thread::sleep_for(_policy.block_timeout);
+            break;
+        }
+    }
+}
+
+//==============================================================================
+std::chrono::microseconds SpinStrategy::next_wait() const
+{
+    switch (_policy.kind)
+    {
+        case SpinPolicy::Kind::ADAPTIVE_BACKOFF:
+        {
+            return _idle_spins < BACKOFF_YIELD_SPINS ? std::chrono::microseconds(0) : _backoff;
+        }
+        case SpinPolicy::Kind::BLOCKING:
+        {
+            return _policy.block_timeout;
+        }
+        default:
+        {
+            return std::chrono::microseconds(0);
+        }
+    }
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -16,6 +16,7 @@
  */
 
 #include <is/core/runtime/StringTemplate.hpp>
+#include <is/utils/Profiler.hpp>
 
 #include <vector>
 
@@ -76,6 +77,8 @@ public:
     const std::string compute_string(
             const eprosima::xtypes::DynamicData& message) const
     {
+        const utils::Profiler::Scope profile("StringTemplate::compute_string", message.type().name());
+
         std::string result;
         if (!_components.empty())
         {
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/ThreadSettings.hpp>
+#include <is/utils/Log.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <fstream>
+#include <sstream>
+
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+#ifdef __linux__
+
+//==============================================================================
+/**
+ * @brief Reads the CPUs of a NUMA node from sysfs, where they are listed as in `0-3,8-11`.
+ */
+bool numa_node_cpus(
+        int node,
+        std::vector<int>& cpus)
+{
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!file || !std::getline(file, list))
+    {
+        return false;
+    }
+
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ','))
+    {
+        const std::size_t dash = range.find('-');
+        try
+        {
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    return !cpus.empty();
+}
+
+//==============================================================================
+/**
+ * @brief Makes the memory allocated from now on by the calling thread come preferably from a NUMA node.
+ *
+ *        Calls the system directly, to avoid depending on libnuma.
+ */
+bool prefer_numa_node(
+        int node)
+{
+    constexpr std::size_t bits_per_word = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(static_cast<std::size_t>(node) / bits_per_word + 1, 0);
+    mask[static_cast<std::size_t>(node) / bits_per_word] = 1UL << (static_cast<std::size_t>(node) % bits_per_word);
+
+    return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), mask.size() * bits_per_word + 1) == 0;
+}
+
+#endif //  __linux__
+
+} //  anonymous namespace
+
+//==============================================================================
+bool ThreadSettings::apply() const
+{
+#ifdef __linux__
+    utils::Logger logger("is::core::ThreadSettings");
+    bool okay = true;
+
+    if (!name.empty())
+    {
+        const int result = pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+        if (result != 0)
+        {
+            logger << utils::Logger::Level::WARN
+                   << "Could not set the name of the thread '" << name << "': "
+                   << std::strerror(result) << std::endl;
+            okay = false;
+        }
+    }
+
+    std::vector<int> allowed_cpus = cpus;
+
+    if (numa_node >= 0)
+    {
+        if (allowed_cpus.empty() && !numa_node_cpus(numa_node, allowed_cpus))
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not find the CPUs of the NUMA node " << numa_node
+                   << " for the thread '" << name << "'." << std::endl;
+            okay = false;
+        }
+
+        if (!prefer_numa_node(numa_node))
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not set the NUMA node " << numa_node << " as the preferred one for the "
+                   << "memory of the thread '" << name << "': " << std::strerror(errno) << std::endl;
+            okay = false;
+        }
+    }
+
+    if (!allowed_cpus.empty())
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (const int cpu : allowed_cpus)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE)
+            {
+                logger << utils::Logger::Level::WARN
+                       << "Ignoring the invalid CPU " << cpu << " for the thread '" << name << "'." << std::endl;
+                continue;
+            }
+
+            CPU_SET(cpu, &cpu_set);
+        }
+
+        const int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (result != 0)
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not pin the thread '" << name << "' to the requested CPUs: "
+                   << std::strerror(result) << std::endl;
+            okay = false;
+        }
+        else
+        {
+            logger << utils::Logger::Level::DEBUG
+                   << "Pinned the thread '" << name << "' to " << allowed_cpus.size() << " CPU(s)." << std::endl;
+        }
+    }
+
+    if (priority > 0)
+    {
+        sched_param param{};
+        param.sched_priority = priority;
+
+        const int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (result != 0)
+        {
+            logger << utils::Logger::Level::ERROR
+                   << "Could not set the real-time priority " << priority << " for the thread '"
+                   << name << "': " << std::strerror(result)
+                   << ". Check the RLIMIT_RTPRIO limit, or the CAP_SYS_NICE capability." << std::endl;
+            okay = false;
+        }
+    }
+
+    return okay;
+#else
+    return priority == 0 && numa_node < 0;
+#endif //  __linux__
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
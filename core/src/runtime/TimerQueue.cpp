@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/TimerQueue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+class TimerQueue::Implementation
+{
+public:
+
+    Implementation(
+            const std::string& name)
+        : _name(name)
+        , _state(std::make_shared<State>())
+    {
+    }
+
+    ~Implementation()
+    {
+        stop();
+    }
+
+    bool schedule(
+            Clock::time_point deadline,
+            Task&& task)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_state->mutex);
+            if (_state->stopped)
+            {
+                return false;
+            }
+
+            _state->entries.push(Entry{deadline, _state->sequence++, std::move(task)});
+            _state->pending.store(_state->entries.size(), std::memory_order_relaxed);
+
+            if (!_thread.joinable())
+            {
+                _thread = std::thread(&Implementation::run, _state, _name);
+            }
+        }
+
+        _state->cv.notify_one();
+        return true;
+    }
+
+    std::size_t pending() const
+    {
+        return _state->pending.load(std::memory_order_relaxed);
+    }
+
+    void stop()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_state->mutex);
+            _state->stopped = true;
+        }
+
+        _state->cv.notify_all();
+
+        if (_thread.joinable())
+        {
+            /**
+             * A task which stops the queue, or destroys it, cannot wait for its own thread,
+             * which finishes on its own once the task returns. It shares the state,
+             * so it can outlive this object.
+             */
+            if (_thread.get_id() == std::this_thread::get_id())
+            {
+                _thread.detach();
+            }
+            else
+            {
+                _thread.join();
+            }
+        }
+
+        /**
+         * Tasks are destroyed outside of the lock, because they might hold
+         * resources whose destructors end up using this queue.
+         */
+        EntryQueue discarded;
+        {
+            std::unique_lock<std::mutex> lock(_state->mutex);
+            std::swap(discarded, _state->entries);
+            _state->pending.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    struct Entry
+    {
+        Clock::time_point deadline;
+        uint64_t sequence;
+        Task task;
+    };
+
+    /**
+     * Orders the entries so that the earliest deadline is on top of the queue.
+     * Ties are resolved by scheduling order.
+     */
+    struct Later
+    {
+        bool operator ()(
+                const Entry& a,
+                const Entry& b) const
+        {
+            if (a.deadline == b.deadline)
+            {
+                return a.sequence > b.sequence;
+            }
+
+            return a.deadline > b.deadline;
+        }
+
+    };
+
+    using EntryQueue = std::priority_queue<Entry, std::vector<Entry>, Later>;
+
+    /**
+     * @brief Everything used by the background thread, which keeps it alive while it runs.
+     */
+    struct State
+    {
+        std::mutex mutex;
+
+        std::condition_variable cv;
+
+        EntryQueue entries;
+
+        uint64_t sequence = 0;
+
+        /**
+         * Copy of the number of entries, so that it can be read without taking the lock.
+         */
+        std::atomic<std::size_t> pending{0};
+
+        bool stopped = false;
+    };
+
+    static void run(
+            std::shared_ptr<State> state,
+            const std::string& name)
+    {
+#ifdef __linux__
+        pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+        static_cast<void>(name);
+#endif //  __linux__
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        while (!state->stopped)
+        {
+            if (state->entries.empty())
+            {
+                state->cv.wait(lock);
+                continue;
+            }
+
+            const Clock::time_point deadline = state->entries.top().deadline;
+            if (Clock::now() < deadline)
+            {
+                state->cv.wait_until(lock, deadline);
+                continue;
+            }
+
+            /**
+             * std::priority_queue::top() only gives const access, but the entry
+             * is popped right after, so moving the task out of it is safe.
+             */
+            Task task = std::move(const_cast<Entry&>(state->entries.top()).task);
+            state->entries.pop();
+            state->pending.store(state->entries.size(), std::memory_order_relaxed);
+
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+        }
+    }
+
+    /**
+     * Class members.
+     */
+
+    const std::string _name;
+
+    const std::shared_ptr<State> _state;
+
+    std::thread _thread;
+};
+
+//==============================================================================
+TimerQueue::TimerQueue(
+        const std::string& name)
+    : _pimpl(new Implementation(name))
+{
+}
+
+//==============================================================================
+TimerQueue::~TimerQueue()
+{
+    _pimpl.reset();
+}
+
+//==============================================================================
+bool TimerQueue::schedule(
+        Clock::time_point deadline,
+        Task task)
+{
+    return _pimpl->schedule(deadline, std::move(task));
+}
+
+//==============================================================================
+bool TimerQueue::schedule_after(
+        Clock::duration delay,
+        Task task)
+{
+    return _pimpl->schedule(Clock::now() + delay, std::move(task));
+}
+
+//==============================================================================
+std::size_t TimerQueue::pending() const
+{
+    return _pimpl->pending();
+}
+
+//==============================================================================
+void TimerQueue::stop()
+{
+    _pimpl->stop();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/TopicDemand.hpp>
+#include <is/utils/Log.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+class TopicDemand::Implementation : public std::enable_shared_from_this<Implementation>
+{
+public:
+
+    Implementation(
+            const std::string& topic_name,
+            std::shared_ptr<std::atomic_bool> gate,
+            TimerQueue& timers)
+        : _topic_name(topic_name)
+        , _gate(std::move(gate))
+        , _timers(timers)
+        , _active(false)
+        , _logger("is::core::TopicDemand")
+    {
+    }
+
+    void add_publisher(
+            TopicPublisher& publisher)
+    {
+        std::size_t index;
+        {
+            /**
+             * Publishers are considered to have subscribers until they report otherwise.
+             */
+            std::unique_lock<std::mutex> lock(_matched_mtx);
+            index = _matched.size();
+            _matched.push_back(1);
+            _active = true;
+        }
+
+        std::weak_ptr<Implementation> weak_self = shared_from_this();
+        publisher.set_matched_callback([weak_self, index](std::size_t matched_subscribers)
+                {
+                    if (auto self = weak_self.lock())
+                    {
+                        self->matched(index, matched_subscribers);
+                    }
+                });
+    }
+
+    void add_source(
+            Source source)
+    {
+        std::unique_lock<std::mutex> lock(_sources_mtx);
+        _sources.push_back(SourceState{std::move(source), false, false});
+    }
+
+    bool switch_sources()
+    {
+        std::unique_lock<std::mutex> lock(_sources_mtx);
+
+        const bool subscribe = _active && _gate->load();
+        bool valid = true;
+
+        for (SourceState& source : _sources)
+        {
+            /**
+             * A source that failed to unsubscribe keeps its subscription for good: it is neither
+             * asked to unsubscribe again, nor subscribed a second time.
+             */
+            if (source.subscribed == subscribe || source.stuck)
+            {
+                continue;
+            }
+
+            if (source.source(subscribe))
+            {
+                source.subscribed = subscribe;
+            }
+            else if (subscribe)
+            {
+                valid = false;
+            }
+            else
+            {
+                source.stuck = true;
+            }
+        }
+
+        _logger << utils::Logger::Level::DEBUG
+                << "The topic '" << _topic_name << "' is now "
+                << (subscribe ? "active" : "inactive") << "." << std::endl;
+
+        return valid;
+    }
+
+    bool stop()
+    {
+        switch_sources();
+
+        std::unique_lock<std::mutex> lock(_sources_mtx);
+        return std::none_of(_sources.begin(), _sources.end(), [](const SourceState& source)
+                       {
+                           return source.subscribed;
+                       });
+    }
+
+    bool active() const
+    {
+        return _active.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    void matched(
+            std::size_t index,
+            std::size_t matched_subscribers)
+    {
+        bool changed;
+        {
+            std::unique_lock<std::mutex> lock(_matched_mtx);
+            _matched[index] = matched_subscribers;
+
+            const bool active = std::any_of(_matched.begin(), _matched.end(), [](std::size_t count)
+                            {
+                                return count > 0;
+                            });
+            changed = (active != _active);
+            _active = active;
+        }
+
+        if (changed)
+        {
+            std::weak_ptr<Implementation> weak_self = shared_from_this();
+            _timers.schedule_after(std::chrono::milliseconds(0), [weak_self]()
+                    {
+                        if (auto self = weak_self.lock())
+                        {
+                            self->switch_sources();
+                        }
+                    });
+        }
+    }
+
+    /**
+     * Helper struct to keep track of the subscription of each source.
+     */
+    struct SourceState
+    {
+        Source source;
+        bool subscribed;
+        bool stuck;
+    };
+
+    /**
+     * Class members.
+     */
+
+    const std::string _topic_name;
+
+    std::shared_ptr<std::atomic_bool> _gate;
+
+    TimerQueue& _timers;
+
+    std::mutex _matched_mtx;
+
+    std::vector<std::size_t> _matched;
+
+    std::atomic_bool _active;
+
+    std::mutex _sources_mtx;
+
+    std::vector<SourceState> _sources;
+
+    utils::Logger _logger;
+};
+
+//==============================================================================
+TopicDemand::TopicDemand(
+        const std::string& topic_name,
+        std::shared_ptr<std::atomic_bool> gate,
+        TimerQueue& timers)
+    : _pimpl(std::make_shared<Implementation>(topic_name, std::move(gate), timers))
+{
+}
+
+//==============================================================================
+void TopicDemand::add_publisher(
+        TopicPublisher& publisher)
+{
+    _pimpl->add_publisher(publisher);
+}
+
+//==============================================================================
+void TopicDemand::add_source(
+        Source source)
+{
+    _pimpl->add_source(std::move(source));
+}
+
+//==============================================================================
+bool TopicDemand::start()
+{
+    return _pimpl->switch_sources();
+}
+
+//==============================================================================
+bool TopicDemand::stop()
+{
+    return _pimpl->stop();
+}
+
+//==============================================================================
+bool TopicDemand::active() const
+{
+    return _pimpl->active();
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
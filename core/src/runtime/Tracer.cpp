@@ -0,0 +1,403 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/Tracer.hpp>
+#include <is/utils/Log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif //  __linux__
+
+namespace eprosima {
+namespace is {
+namespace core {
+
+namespace {
+
+/**
+ * Identifies the threads in the trace events with small numbers, assigned on first use.
+ */
+uint32_t thread_number()
+{
+    static std::atomic<uint32_t> next_thread(1);
+    thread_local const uint32_t number = next_thread++;
+    return number;
+}
+
+void write_json_string(
+        std::ostream& out,
+        const std::string& value)
+{
+    out << '"';
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20)
+                {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+} //  anonymous namespace
+
+class Tracer::Implementation
+{
+public:
+
+    Implementation(
+            const Policy& policy)
+        : _policy(policy)
+        , _threshold(policy.sample_rate >= 1.0
+            ? UINT64_MAX
+            : static_cast<uint64_t>(std::max(policy.sample_rate, 0.0) * 18446744073709551616.0))
+        , _next_trace(1)
+        , _pid(process_id())
+        , _written(0)
+        , _first_event(true)
+        , _dropped(0)
+        , _stopped(false)
+        , _logger("is::core::Tracer")
+    {
+        /**
+         * The spans are measured with the steady clock, and written with system clock timestamps.
+         */
+        const auto system_now = std::chrono::system_clock::now();
+        const auto steady_now = Clock::now();
+        _epoch_offset = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            system_now.time_since_epoch()).count()
+                - std::chrono::duration_cast<std::chrono::nanoseconds>(
+            steady_now.time_since_epoch()).count();
+
+        open_file();
+
+        _logger << utils::Logger::Level::INFO
+                << "Tracing " << _policy.sample_rate * 100 << "% of the messages into '"
+                << _policy.file << "'." << std::endl;
+
+        _thread = std::thread(&Implementation::run, this);
+    }
+
+    ~Implementation()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _cv.notify_all();
+
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+
+        close_file();
+    }
+
+    uint64_t sample()
+    {
+        if (_threshold == 0)
+        {
+            return 0;
+        }
+
+        /**
+         * Each thread draws from its own xorshift generator, so sampling takes no lock.
+         */
+        thread_local uint64_t state = (std::hash<std::thread::id>()(std::this_thread::get_id()) << 1) | 1;
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        const uint64_t draw = state * 0x2545F4914F6CDD1DULL;
+
+        if (_threshold != UINT64_MAX && draw >= _threshold)
+        {
+            return 0;
+        }
+
+        return _next_trace.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record(
+            uint64_t trace,
+            const char* name,
+            const std::string& route,
+            const std::string& system,
+            Clock::time_point start,
+            Clock::time_point end)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_pending.size() >= MAX_PENDING)
+        {
+            ++_dropped;
+            return;
+        }
+
+        _pending.push_back(SpanRecord{trace, name, route, system, start, end, thread_number()});
+    }
+
+private:
+
+    struct SpanRecord
+    {
+        uint64_t trace;
+        const char* name;
+        std::string route;
+        std::string system;
+        Clock::time_point start;
+        Clock::time_point end;
+        uint32_t thread;
+    };
+
+    /**
+     * Spans kept in memory at most between two writes. Beyond that, they are dropped.
+     */
+    static constexpr std::size_t MAX_PENDING = 65536;
+
+    /**
+     * Period between two writes of the pending spans.
+     */
+    static constexpr std::chrono::milliseconds WRITE_PERIOD{200};
+
+    static int process_id()
+    {
+#ifdef __linux__
+        return static_cast<int>(getpid());
+#else
+        return 0;
+#endif //  __linux__
+    }
+
+    void run()
+    {
+        std::vector<SpanRecord> spans;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _cv.wait_for(lock, WRITE_PERIOD, [this]()
+                    {
+                        return _stopped;
+                    });
+
+            std::swap(spans, _pending);
+            const uint64_t dropped = _dropped;
+            _dropped = 0;
+            const bool stopped = _stopped;
+
+            lock.unlock();
+            write(spans);
+            spans.clear();
+
+            if (dropped > 0)
+            {
+                _logger << utils::Logger::Level::WARN
+                        << "Dropped " << dropped << " spans, since they were recorded "
+                        << "faster than they could be written." << std::endl;
+            }
+            lock.lock();
+
+            if (stopped)
+            {
+                break;
+            }
+        }
+    }
+
+    void write(
+            const std::vector<SpanRecord>& spans)
+    {
+        if (!_file.is_open())
+        {
+            return;
+        }
+
+        for (const SpanRecord& span : spans)
+        {
+            const auto start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                span.start.time_since_epoch()).count() + _epoch_offset;
+            const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                span.end - span.start).count();
+
+            const std::streampos before = _file.tellp();
+
+            _file << (_first_event ? "" : ",\n") << "{\"name\":\"" << span.name << "\",\"cat\":";
+            write_json_string(_file, span.route);
+            _file << ",\"ph\":\"X\",\"ts\":" << start_ns / 1000 << "." << padded(start_ns % 1000)
+                  << ",\"dur\":" << duration_ns / 1000 << "." << padded(duration_ns % 1000)
+                  << ",\"pid\":" << _pid << ",\"tid\":" << span.thread
+                  << ",\"args\":{\"trace\":" << span.trace << ",\"route\":";
+            write_json_string(_file, span.route);
+            if (!span.system.empty())
+            {
+                _file << ",\"system\":";
+                write_json_string(_file, span.system);
+            }
+            _file << "}}";
+
+            _first_event = false;
+            _written += static_cast<std::size_t>(_file.tellp() - before);
+
+            if (_written >= _policy.max_file_size)
+            {
+                rotate();
+            }
+        }
+
+        _file.flush();
+    }
+
+    static std::string padded(
+            int64_t nanoseconds)
+    {
+        char digits[4];
+        std::snprintf(digits, sizeof(digits), "%03d", static_cast<int>(nanoseconds < 0 ? 0 : nanoseconds));
+        return digits;
+    }
+
+    void open_file()
+    {
+        _file.open(_policy.file, std::ios::out | std::ios::trunc);
+        if (!_file.is_open())
+        {
+            _logger << utils::Logger::Level::ERROR
+                    << "Could not open the trace file '" << _policy.file << "'." << std::endl;
+            return;
+        }
+
+        _file << "[\n";
+        _written = 2;
+        _first_event = true;
+    }
+
+    void close_file()
+    {
+        if (_file.is_open())
+        {
+            _file << "\n]\n";
+            _file.close();
+        }
+    }
+
+    void rotate()
+    {
+        close_file();
+
+        if (_policy.max_files > 0)
+        {
+            for (std::size_t i = _policy.max_files - 1; i > 0; --i)
+            {
+                std::rename((_policy.file + "." + std::to_string(i)).c_str(),
+                        (_policy.file + "." + std::to_string(i + 1)).c_str());
+            }
+            std::rename(_policy.file.c_str(), (_policy.file + ".1").c_str());
+        }
+
+        open_file();
+    }
+
+    /**
+     * Class members.
+     */
+
+    const Policy _policy;
+
+    const uint64_t _threshold;
+
+    std::atomic<uint64_t> _next_trace;
+
+    const int _pid;
+
+    int64_t _epoch_offset;
+
+    std::ofstream _file;
+
+    std::size_t _written;
+
+    bool _first_event;
+
+    std::mutex _mutex;
+
+    std::condition_variable _cv;
+
+    std::vector<SpanRecord> _pending;
+
+    uint64_t _dropped;
+
+    bool _stopped;
+
+    std::thread _thread;
+
+    utils::Logger _logger;
+};
+
+//==============================================================================
+Tracer::Tracer(
+        const Policy& policy)
+    : _pimpl(new Implementation(policy))
+{
+}
+
+//==============================================================================
+Tracer::~Tracer()
+{
+    _pimpl.reset();
+}
+
+//==============================================================================
+uint64_t Tracer::sample()
+{
+    return _pimpl->sample();
+}
+
+//==============================================================================
+void Tracer::record(
+        uint64_t trace,
+        const char* name,
+        const std::string& route,
+        const std::string& system,
+        Clock::time_point start,
+        Clock::time_point end)
+{
+    _pimpl->record(trace, name, route, system, start, end);
+}
+
+} //  namespace core
+} //  namespace is
+} //  namespace eprosima
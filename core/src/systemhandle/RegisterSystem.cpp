@@ -32,6 +32,7 @@ SystemHandleInfo::SystemHandleInfo(
     , topic_subscriber(dynamic_cast<TopicSubscriberSystem*>(handle.get()))
     , service_client(dynamic_cast<ServiceClientSystem*>(handle.get()))
     , service_provider(dynamic_cast<ServiceProviderSystem*>(handle.get()))
+    , event_driven(dynamic_cast<EventDrivenSystem*>(handle.get()))
 {
 }
 
@@ -43,6 +44,7 @@ SystemHandleInfo::SystemHandleInfo(
     , topic_subscriber(std::move(other.topic_subscriber))
     , service_client(std::move(other.service_client))
     , service_provider(std::move(other.service_provider))
+    , event_driven(std::move(other.event_driven))
     , types(std::move(other.types))
 {
 }
@@ -94,6 +96,12 @@ SystemHandleInfo Register::get(
 {
     utils::Logger logger("is::core::systemhandle::RegisterSystem");
 
+    /**
+     * Middlewares may be loaded concurrently, so the factory is looked up under the lock,
+     * but it is called outside of it.
+     */
+    std::unique_lock<std::mutex> lock(_mutex);
+
     const FactoryMap::const_iterator it_mw = _info_map.find(middleware);
 
     if (it_mw == _info_map.end())
@@ -113,7 +121,10 @@ SystemHandleInfo Register::get(
                << std::endl;
     }
 
-    return SystemHandleInfo(_info_map.at(middleware)());
+    const FactoryMap::mapped_type factory = it_mw->second;
+    lock.unlock();
+
+    return SystemHandleInfo(factory());
 }
 
 } //  namespace internal
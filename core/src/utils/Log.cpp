@@ -16,13 +16,414 @@
  */
 
 #include <is/utils/Log.hpp>
+#include <is/utils/SpscQueue.hpp>
 
 #include <is/config.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
 namespace eprosima {
 namespace is {
 namespace utils {
 
+namespace {
+
+/**
+ * Messages that a thread can have waiting to be written before it starts dropping them.
+ */
+constexpr std::size_t QUEUE_CAPACITY = 1024;
+
+/**
+ * Maximum time that the background thread sleeps without checking the queues,
+ * in case it missed a wake-up.
+ */
+constexpr std::chrono::milliseconds IDLE_PERIOD{50};
+
+//==============================================================================
+/**
+ * @brief A message logged by a thread, with its position among the messages of every thread.
+ */
+struct Record
+{
+    uint64_t sequence = 0;
+    std::string text;
+};
+
+//==============================================================================
+/**
+ * @brief Messages logged by a thread, waiting to be written.
+ *        It outlives its thread until the background thread has written all of them.
+ */
+struct ThreadQueue
+{
+    ThreadQueue()
+        : messages(QUEUE_CAPACITY)
+    {
+    }
+
+    SpscQueue<Record> messages;
+    std::atomic_bool closed{false};
+};
+
+//==============================================================================
+/**
+ * @brief Writes the messages of every thread to the standard output, from its own thread.
+ *        It is never destroyed, since messages can be logged while the process exits.
+ */
+class Writer
+{
+public:
+
+    static Writer& instance()
+    {
+        static Writer* const writer = new Writer();
+        return *writer;
+    }
+
+    /**
+     * @brief Registers the queue of a new thread.
+     */
+    void add(
+            std::shared_ptr<ThreadQueue> queue)
+    {
+        std::unique_lock<std::mutex> lock(_queues_mutex);
+        _queues.emplace_back(std::move(queue));
+        _changes.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Tells that the thread of a queue has finished.
+     */
+    void close(
+            ThreadQueue& queue)
+    {
+        queue.closed.store(true, std::memory_order_release);
+        _changes.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Queues a message, waking the background thread up if it is sleeping.
+     *        Must only be called from the thread of the queue.
+     */
+    void submit(
+            ThreadQueue& queue,
+            std::string&& message)
+    {
+        Record record;
+        record.sequence = _sequence.fetch_add(1);
+        record.text = std::move(message);
+        if (!queue.messages.try_push(std::move(record)))
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleeping.load(std::memory_order_acquire))
+        {
+            _wake_up.notify_one();
+        }
+    }
+
+    /**
+     * @brief Writes the queued messages from the calling thread.
+     */
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(_write_mutex);
+        write_pending();
+    }
+
+private:
+
+    Writer()
+        : _changes(0)
+        , _sequence(0)
+        , _dropped(0)
+        , _sleeping(false)
+        , _seen_changes(0)
+        , _stale(false)
+    {
+        std::atexit([]()
+                {
+                    Writer::instance().flush();
+                });
+
+        std::thread([this]()
+                {
+                    run();
+                }).detach();
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_write_mutex);
+        while (true)
+        {
+            if (write_pending())
+            {
+                continue;
+            }
+
+            /**
+             * The queues are checked again once the sleep has been announced,
+             * since a message queued meanwhile would not wake this thread up.
+             */
+            _sleeping.store(true);
+            if (!write_pending())
+            {
+                _wake_up.wait_for(lock, IDLE_PERIOD);
+            }
+            _sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Writes the queued messages of every thread in the order they were logged.
+     *        Must be called with the write mutex taken, which makes the caller
+     *        the only consumer of the queues.
+     *
+     *        Only the messages numbered before the start of the call are written: any of them
+     *        which was logged after another one was queued, such as a message logged by a thread
+     *        woken up by another one which had logged, is also in its queue by then.
+     *        Later messages are kept for the next call, since earlier ones could be still
+     *        on their way to another queue.
+     *
+     * @returns `true` if anything was written or is left to write.
+     */
+    bool write_pending()
+    {
+        const uint64_t end = _sequence.load();
+
+        const uint64_t changes = _changes.load(std::memory_order_acquire);
+        if (changes != _seen_changes || _stale)
+        {
+            _seen_changes = changes;
+            refresh();
+        }
+
+        const std::size_t kept = _pending.size();
+        Record record;
+        for (const std::shared_ptr<ThreadQueue>& queue : _snapshot)
+        {
+            const bool closed = queue->closed.load(std::memory_order_acquire);
+            while (queue->messages.try_pop(record))
+            {
+                _pending.emplace_back(std::move(record));
+            }
+            _stale |= closed;
+        }
+
+        if (_pending.size() > kept)
+        {
+            std::sort(_pending.begin(), _pending.end(), [](
+                        const Record& a,
+                        const Record& b)
+                    {
+                        return a.sequence < b.sequence;
+                    });
+        }
+
+        bool written = false;
+        auto next = _pending.begin();
+        for (; next != _pending.end() && next->sequence < end; ++next)
+        {
+            std::cout << next->text;
+            written = true;
+        }
+        _pending.erase(_pending.begin(), next);
+
+        const uint64_t dropped = _dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0)
+        {
+            std::cout << "[Integration Service][WARN] " << dropped
+                      << " log message(s) dropped: they were logged faster than they could be written."
+                      << std::endl;
+            written = true;
+        }
+
+        if (written)
+        {
+            std::cout.flush();
+        }
+        return written || !_pending.empty();
+    }
+
+    /**
+     * @brief Takes the queues registered so far, forgetting those of finished threads once written.
+     */
+    void refresh()
+    {
+        std::unique_lock<std::mutex> lock(_queues_mutex);
+        for (auto it = _queues.begin(); it != _queues.end();)
+        {
+            if ((*it)->closed.load(std::memory_order_acquire) && (*it)->messages.empty())
+            {
+                it = _queues.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        _snapshot = _queues;
+        _stale = false;
+    }
+
+    std::mutex _queues_mutex;
+
+    std::vector<std::shared_ptr<ThreadQueue> > _queues;
+
+    std::atomic<uint64_t> _changes;
+
+    /**
+     * Number given to the next message, whichever its thread.
+     */
+    std::atomic<uint64_t> _sequence;
+
+    std::atomic<uint64_t> _dropped;
+
+    std::atomic_bool _sleeping;
+
+    std::mutex _write_mutex;
+
+    std::condition_variable _wake_up;
+
+    /**
+     * Members only used with the write mutex taken.
+     */
+
+    std::vector<std::shared_ptr<ThreadQueue> > _snapshot;
+
+    /**
+     * Messages taken from the queues but not written yet, sorted by their sequence.
+     */
+    std::vector<Record> _pending;
+
+    uint64_t _seen_changes;
+
+    bool _stale;
+};
+
+//==============================================================================
+/**
+ * @brief A message being composed by a thread with a Logger.
+ */
+struct Message
+{
+    const Logger* logger = nullptr;
+    bool visible = false;
+    std::ostringstream text;
+};
+
+//==============================================================================
+/**
+ * @brief The messages being composed by a thread, one per Logger in use,
+ *        and the queue where they go once complete. The buffers are reused.
+ */
+struct ThreadState
+{
+    ThreadState()
+        : queue(std::make_shared<ThreadQueue>())
+    {
+        Writer::instance().add(queue);
+    }
+
+    ~ThreadState()
+    {
+        Writer::instance().close(*queue);
+    }
+
+    Message* find(
+            const Logger* logger)
+    {
+        for (const std::unique_ptr<Message>& message : messages)
+        {
+            if (message->logger == logger)
+            {
+                return message.get();
+            }
+        }
+        return nullptr;
+    }
+
+    Message& start(
+            const Logger* logger)
+    {
+        Message* message = find(nullptr);
+        if (!message)
+        {
+            messages.emplace_back(new Message());
+            message = messages.back().get();
+        }
+        message->logger = logger;
+        return *message;
+    }
+
+    void finish(
+            Message& message)
+    {
+        if (message.visible)
+        {
+            Writer::instance().submit(*queue, message.text.str());
+        }
+        message.logger = nullptr;
+        message.visible = false;
+        message.text.str(std::string());
+        message.text.clear();
+    }
+
+    std::shared_ptr<ThreadQueue> queue;
+    std::vector<std::unique_ptr<Message> > messages;
+};
+
+thread_local ThreadState* current_state = nullptr;
+
+thread_local bool thread_exited = false;
+
+/**
+ * @brief Releases the state of a thread when it finishes.
+ */
+struct ThreadStateOwner
+{
+    ~ThreadStateOwner()
+    {
+        thread_exited = true;
+        delete current_state;
+        current_state = nullptr;
+    }
+};
+
+//==============================================================================
+/**
+ * @brief Gets the state of the calling thread, creating it the first time.
+ *        A thread that logs while finishing, such as from the destructor of a static object,
+ *        gets a new state which is never released, since nothing would release it.
+ */
+ThreadState& thread_state()
+{
+    if (!current_state)
+    {
+        current_state = new ThreadState();
+        if (!thread_exited)
+        {
+            static thread_local ThreadStateOwner owner;
+            static_cast<void>(owner);
+        }
+    }
+    return *current_state;
+}
+
+} //  anonymous namespace
+
 //==============================================================================
 Logger::Logger(
         const std::string& header)
@@ -32,7 +433,6 @@ Logger::Logger(
 #else
     , _max_level(Level::INFO)     // TODO (@jamoralp): make this configurable by the user and by CMAKE_BUILD_TYPE flag
 #endif //  IS_COMPILE_DEBUG
-    , _status(CurrentLevelStatus::NON_SPECIFIED)
 {
 }
 
@@ -45,54 +445,62 @@ const Logger::Level& Logger::get_level() const
 Logger& Logger::operator <<(
         const Logger::Level& level)
 {
+    ThreadState& state = thread_state();
+    Message* message = state.find(this);
+    if (!message)
+    {
+        message = &state.start(this);
+    }
+
     if (_max_level >= level)
     {
+        std::ostream& out = message->text;
         switch (level)
         {
             case Level::ERROR:
             {
-                std::cout << bold_on
-                          << red
-                          << "[Integration Service][ERROR] "
-                          << reset;
+                out << bold_on
+                    << red
+                    << "[Integration Service][ERROR] "
+                    << reset;
                 break;
             }
             case Level::WARN:
             {
-                std::cout << bold_on
-                          << yellow
-                          << "[Integration Service][WARN] "
-                          << reset;
+                out << bold_on
+                    << yellow
+                    << "[Integration Service][WARN] "
+                    << reset;
                 break;
             }
             case Level::INFO:
             {
-                std::cout << bold_on
-                          << "[Integration Service][INFO] "
-                          << reset;
+                out << bold_on
+                    << "[Integration Service][INFO] "
+                    << reset;
                 break;
             }
             case Level::DEBUG:
             {
-                std::cout << bold_on
-                          << green
-                          << "[Integration Service][DEBUG] "
-                          << reset;
+                out << bold_on
+                    << green
+                    << "[Integration Service][DEBUG] "
+                    << reset;
                 break;
             }
         }
 
         if (!_header.empty())
         {
-            std::cout << bold_on << "[" << _header << "]" << reset;
+            out << bold_on << "[" << _header << "]" << reset;
         }
 
-        std::cout << " ";
-        _status = CurrentLevelStatus::SPECIFIED;
+        out << " ";
+        message->visible = true;
     }
     else
     {
-        _status = CurrentLevelStatus::SPECIFIED_BUT_HIDDEN;
+        message->visible = false;
     }
 
     return *this;
@@ -102,25 +510,9 @@ Logger& Logger::operator <<(
 Logger& Logger::operator <<(
         const char* message)
 {
-    switch (_status)
+    if (std::ostream* text = current_message())
     {
-        case CurrentLevelStatus::NON_SPECIFIED:
-        {
-            // By default, INFO level will be used if the user has not specified it.
-            operator <<(Level::INFO);
-            return operator <<(message);
-            break;
-        }
-        case CurrentLevelStatus::SPECIFIED:
-        {
-            std::cout << message;
-            break;
-        }
-        case CurrentLevelStatus::SPECIFIED_BUT_HIDDEN:
-        {
-            // Do nothing
-            break;
-        }
+        *text << message;
     }
 
     return *this;
@@ -139,29 +531,44 @@ Logger& Logger::operator <<(
         (*func)(
             std::basic_ostream<char, std::char_traits<char> >&))
 {
-    switch (_status)
+    ThreadState& state = thread_state();
+    Message* message = state.find(this);
+    if (!message)
     {
-        case CurrentLevelStatus::NON_SPECIFIED:
-        {
-            // Do nothing
-            break;
-        }
-        case CurrentLevelStatus::SPECIFIED:
-        {
-            std::cout << reset;
-            std::cout << func;
-            [[fallthrough]];
-        }
-        case CurrentLevelStatus::SPECIFIED_BUT_HIDDEN:
-        {
-            _status = CurrentLevelStatus::NON_SPECIFIED;
-            break;
-        }
+        // Do nothing
+        return *this;
+    }
+
+    if (message->visible)
+    {
+        message->text << reset;
+        message->text << func;
     }
+    state.finish(*message);
 
     return *this;
 }
 
+//==============================================================================
+void Logger::flush()
+{
+    Writer::instance().flush();
+}
+
+//==============================================================================
+std::ostream* Logger::current_message()
+{
+    Message* message = thread_state().find(this);
+    if (!message)
+    {
+        // By default, INFO level will be used if the user has not specified it.
+        operator <<(Level::INFO);
+        message = thread_state().find(this);
+    }
+
+    return message->visible ? &message->text : nullptr;
+}
+
 //==============================================================================
 std::ostream& Logger::bold_on(
         std::ostream& os)
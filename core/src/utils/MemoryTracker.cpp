@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/config.hpp>
+#include <is/utils/MemoryTracker.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace eprosima {
+namespace is {
+namespace utils {
+
+//==============================================================================
+class MemoryTracker::Account
+{
+public:
+
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> allocated_bytes{0};
+    std::atomic<uint64_t> freed_bytes{0};
+};
+
+namespace {
+
+/**
+ * The account charged when no Scope is active. It is constant-initialized, so that
+ * it can be charged by the allocations made before any dynamic initialization.
+ */
+MemoryTracker::Account other_account;
+
+thread_local MemoryTracker::Account* current_account = nullptr;
+
+thread_local MemoryTracker::ThreadCounters thread_allocations;
+
+//==============================================================================
+/**
+ * @brief Accounts by name. Neither the registry nor the accounts are ever destroyed,
+ *        since the blocks charged to them may be freed while the process exits.
+ */
+struct Registry
+{
+    std::mutex mutex;
+    std::map<std::string, MemoryTracker::Account*> accounts;
+};
+
+Registry& registry()
+{
+    static Registry* const instance = new Registry();
+    return *instance;
+}
+
+} //  anonymous namespace
+
+//==============================================================================
+MemoryTracker::Scope::Scope(
+        Account* account)
+    : _previous(current_account)
+{
+    current_account = account;
+}
+
+//==============================================================================
+MemoryTracker::Scope::~Scope()
+{
+    current_account = _previous;
+}
+
+//==============================================================================
+bool MemoryTracker::enabled()
+{
+#ifdef IS_PROFILE_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif //  IS_PROFILE_ALLOCATIONS
+}
+
+//==============================================================================
+MemoryTracker::Account* MemoryTracker::account(
+        const std::string& name)
+{
+    std::unique_lock<std::mutex> lock(registry().mutex);
+    Account*& account = registry().accounts[name];
+    if (!account)
+    {
+        account = new Account();
+    }
+    return account;
+}
+
+//==============================================================================
+std::map<std::string, MemoryTracker::Usage> MemoryTracker::usage()
+{
+    const auto read = [](const Account& account)
+            {
+                Usage usage;
+                usage.allocations = account.allocations.load(std::memory_order_relaxed);
+                usage.allocated_bytes = account.allocated_bytes.load(std::memory_order_relaxed);
+                const uint64_t freed = account.freed_bytes.load(std::memory_order_relaxed);
+                usage.live_bytes = usage.allocated_bytes > freed ? usage.allocated_bytes - freed : 0;
+                return usage;
+            };
+
+    std::map<std::string, Usage> usages;
+    {
+        std::unique_lock<std::mutex> lock(registry().mutex);
+        for (const auto& [name, account] : registry().accounts)
+        {
+            usages[name] = read(*account);
+        }
+    }
+    usages["other"] = read(other_account);
+    return usages;
+}
+
+//==============================================================================
+MemoryTracker::ThreadCounters MemoryTracker::thread_counters()
+{
+    return thread_allocations;
+}
+
+} //  namespace utils
+} //  namespace is
+} //  namespace eprosima
+
+#ifdef IS_PROFILE_ALLOCATIONS
+
+namespace {
+
+using eprosima::is::utils::MemoryTracker;
+
+/**
+ * Header kept before each block, remembering which account to release it from.
+ * Its size keeps the blocks aligned as `malloc` returns them.
+ */
+struct alignas(alignof(std::max_align_t)) BlockHeader
+{
+    MemoryTracker::Account* account;
+    std::size_t size;
+};
+
+//==============================================================================
+void* tracked_allocation(
+        std::size_t size)
+{
+    using namespace eprosima::is::utils;
+
+    MemoryTracker::Account* const account = current_account ? current_account : &other_account;
+    ++thread_allocations.allocations;
+    thread_allocations.bytes += size;
+
+    while (true)
+    {
+        if (void* ptr = std::malloc(sizeof(BlockHeader) + size))
+        {
+            account->allocations.fetch_add(1, std::memory_order_relaxed);
+            account->allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+            BlockHeader* const header = static_cast<BlockHeader*>(ptr);
+            header->account = account;
+            header->size = size;
+            return header + 1;
+        }
+
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+//==============================================================================
+void tracked_free(
+        void* ptr) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    BlockHeader* const header = static_cast<BlockHeader*>(ptr) - 1;
+    header->account->freed_bytes.fetch_add(header->size, std::memory_order_relaxed);
+    std::free(header);
+}
+
+} //  anonymous namespace
+
+//==============================================================================
+/**
+ * Replacements of the global allocation functions, which charge every block to an account.
+ * The aligned versions are left to the standard library, since they are seldom used.
+ */
+void* operator new(
+        std::size_t size)
+{
+    return tracked_allocation(size);
+}
+
+void* operator new[](
+        std::size_t size)
+{
+    return tracked_allocation(size);
+}
+
+void* operator new(
+        std::size_t size,
+        const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return tracked_allocation(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](
+        std::size_t size,
+        const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return tracked_allocation(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(
+        void* ptr) noexcept
+{
+    tracked_free(ptr);
+}
+
+void operator delete[](
+        void* ptr) noexcept
+{
+    tracked_free(ptr);
+}
+
+void operator delete(
+        void* ptr,
+        std::size_t) noexcept
+{
+    tracked_free(ptr);
+}
+
+void operator delete[](
+        void* ptr,
+        std::size_t) noexcept
+{
+    tracked_free(ptr);
+}
+
+void operator delete(
+        void* ptr,
+        const std::nothrow_t&) noexcept
+{
+    tracked_free(ptr);
+}
+
+void operator delete[](
+        void* ptr,
+        const std::nothrow_t&) noexcept
+{
+    tracked_free(ptr);
+}
+
+#endif //  IS_PROFILE_ALLOCATIONS
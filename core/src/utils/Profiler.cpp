@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/utils/MemoryTracker.hpp>
+#include <is/utils/Profiler.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace eprosima {
+namespace is {
+namespace utils {
+
+namespace {
+
+//==============================================================================
+/**
+ * @brief Figures gathered by a thread, by section and key.
+ */
+struct Table
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, Profiler::Entry> entries;
+};
+
+//==============================================================================
+/**
+ * @brief Tables of every thread that profiled something. They are kept once their thread finishes,
+ *        and never destroyed, since threads may still be profiling while the process exits.
+ */
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Table> > tables;
+};
+
+Registry& registry()
+{
+    static Registry* const instance = new Registry();
+    return *instance;
+}
+
+Table& thread_table()
+{
+    thread_local const std::shared_ptr<Table> table = []()
+            {
+                auto new_table = std::make_shared<Table>();
+                std::unique_lock<std::mutex> lock(registry().mutex);
+                registry().tables.push_back(new_table);
+                return new_table;
+            } ();
+    return *table;
+}
+
+} //  anonymous namespace
+
+std::atomic_bool Profiler::_enabled(false);
+
+//==============================================================================
+void Profiler::Scope::start()
+{
+    const MemoryTracker::ThreadCounters counters = MemoryTracker::thread_counters();
+    _allocations = counters.allocations;
+    _allocated_bytes = counters.bytes;
+    _start = std::chrono::steady_clock::now();
+}
+
+//==============================================================================
+void Profiler::Scope::finish()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - _start;
+    const MemoryTracker::ThreadCounters counters = MemoryTracker::thread_counters();
+    const uint64_t allocations = counters.allocations - _allocations;
+    const uint64_t allocated_bytes = counters.bytes - _allocated_bytes;
+    const uint64_t nanoseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    std::string key = _from;
+    if (_to)
+    {
+        key += " -> " + *_to;
+    }
+
+    Table& table = thread_table();
+    std::unique_lock<std::mutex> lock(table.mutex);
+
+    Entry& entry = table.entries[std::string(_section) + '\n' + key];
+    if (entry.calls == 0)
+    {
+        entry.section = _section;
+        entry.key = std::move(key);
+    }
+
+    ++entry.calls;
+    entry.nanoseconds += nanoseconds;
+    entry.max_nanoseconds = std::max(entry.max_nanoseconds, nanoseconds);
+    entry.allocations += allocations;
+    entry.allocated_bytes += allocated_bytes;
+}
+
+//==============================================================================
+void Profiler::enable(
+        bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//==============================================================================
+bool Profiler::counts_allocations()
+{
+    return MemoryTracker::enabled();
+}
+
+//==============================================================================
+std::vector<Profiler::Entry> Profiler::report()
+{
+    std::vector<std::shared_ptr<Table> > tables;
+    {
+        std::unique_lock<std::mutex> lock(registry().mutex);
+        tables = registry().tables;
+    }
+
+    std::unordered_map<std::string, Entry> merged;
+    for (const auto& table : tables)
+    {
+        std::unique_lock<std::mutex> lock(table->mutex);
+        for (const auto& [id, entry] : table->entries)
+        {
+            Entry& total = merged[id];
+            if (total.calls == 0)
+            {
+                total.section = entry.section;
+                total.key = entry.key;
+            }
+
+            total.calls += entry.calls;
+            total.nanoseconds += entry.nanoseconds;
+            total.max_nanoseconds = std::max(total.max_nanoseconds, entry.max_nanoseconds);
+            total.allocations += entry.allocations;
+            total.allocated_bytes += entry.allocated_bytes;
+        }
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(merged.size());
+    for (auto& [id, entry] : merged)
+    {
+        entries.push_back(std::move(entry));
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b)
+            {
+                return a.nanoseconds > b.nanoseconds;
+            });
+
+    return entries;
+}
+
+//==============================================================================
+std::string Profiler::dump(
+        std::size_t max_entries)
+{
+    const std::vector<Entry> entries = report();
+    const std::size_t count = (max_entries == 0 ? entries.size() : std::min(max_entries, entries.size()));
+
+    std::ostringstream out;
+    out << std::left << std::setw(34) << "section" << std::setw(48) << "key" << std::right
+        << std::setw(12) << "calls" << std::setw(12) << "total ms" << std::setw(10) << "mean us"
+        << std::setw(10) << "max us";
+    if (counts_allocations())
+    {
+        out << std::setw(12) << "allocs/call" << std::setw(12) << "bytes/call";
+    }
+    out << "\n";
+
+    out << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Entry& entry = entries[i];
+        const double calls = static_cast<double>(entry.calls);
+        out << std::left << std::setw(34) << entry.section << std::setw(48) << entry.key << std::right
+            << std::setw(12) << entry.calls
+            << std::setw(12) << static_cast<double>(entry.nanoseconds) * 1e-6
+            << std::setw(10) << static_cast<double>(entry.nanoseconds) * 1e-3 / calls
+            << std::setw(10) << static_cast<double>(entry.max_nanoseconds) * 1e-3;
+        if (counts_allocations())
+        {
+            out << std::setw(12) << static_cast<double>(entry.allocations) / calls
+                << std::setw(12) << static_cast<double>(entry.allocated_bytes) / calls;
+        }
+        out << "\n";
+    }
+
+    return out.str();
+}
+
+//==============================================================================
+void Profiler::reset()
+{
+    std::unique_lock<std::mutex> lock(registry().mutex);
+    for (const auto& table : registry().tables)
+    {
+        std::unique_lock<std::mutex> table_lock(table->mutex);
+        table->entries.clear();
+    }
+}
+
+} //  namespace utils
+} //  namespace is
+} //  namespace eprosima
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/systemhandle/AsyncSystemHandle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace async = eprosima::is::async;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+async::Task<int> answer()
+{
+    co_return 42;
+}
+
+async::Task<void> store_answer(
+        int& result)
+{
+    result = co_await answer();
+}
+
+async::Task<void> fail()
+{
+    throw std::runtime_error("expected failure");
+    co_return;
+}
+
+async::Task<void> store_completion(
+        async::Completion<int> completion,
+        int& result)
+{
+    result = co_await completion;
+}
+
+/**
+ * Provider which replies with the request.
+ */
+class EchoProvider : public async::AsyncServiceProvider
+{
+public:
+
+    using async::AsyncServiceProvider::AsyncServiceProvider;
+
+    async::Task<xtypes::DynamicData> call_service_async(
+            xtypes::DynamicData request) override
+    {
+        co_return request;
+    }
+
+};
+
+async::Task<void> store_reply(
+        async::AsyncServiceClient& client,
+        eprosima::is::ServiceProvider& provider,
+        const xtypes::DynamicData& request,
+        std::unique_ptr<xtypes::DynamicData>& reply)
+{
+    reply = std::make_unique<xtypes::DynamicData>(co_await client.call(provider, request));
+}
+
+/**
+ * SystemHandle whose run() coroutine counts the spins in which it gets resumed.
+ */
+class CountingSystem : public async::AsyncSystemHandle
+{
+public:
+
+    bool configure(
+            const eprosima::is::core::RequiredTypes& /*types*/,
+            const YAML::Node& /*configuration*/,
+            eprosima::is::TypeRegistry& /*type_registry*/) override
+    {
+        return true;
+    }
+
+    bool okay() const override
+    {
+        return true;
+    }
+
+    async::Task<void> run() override
+    {
+        for (; resumed < 2; ++resumed)
+        {
+            co_await scheduler().schedule();
+        }
+    }
+
+    int resumed = 0;
+};
+
+} //  anonymous namespace
+
+TEST(AsyncSystemHandle, Spawned_tasks_start_in_the_next_run)
+{
+    async::Scheduler scheduler;
+    int result = 0;
+
+    scheduler.spawn(store_answer(result));
+    EXPECT_EQ(result, 0);
+
+    EXPECT_EQ(scheduler.run_once(), 1u);
+    EXPECT_EQ(result, 42);
+    EXPECT_EQ(scheduler.run_once(), 0u);
+}
+
+TEST(AsyncSystemHandle, Exceptions_of_spawned_tasks_do_not_reach_the_scheduler)
+{
+    async::Scheduler scheduler;
+
+    scheduler.spawn(fail());
+    EXPECT_NO_THROW(scheduler.run_once());
+}
+
+TEST(AsyncSystemHandle, Completions_resume_the_waiting_coroutine_in_the_scheduler)
+{
+    async::Scheduler scheduler;
+    async::Completion<int> completion(scheduler);
+    int result = 0;
+
+    scheduler.spawn(store_completion(completion, result));
+    scheduler.run_once();
+
+    std::thread([completion]() mutable
+            {
+                completion.complete(7);
+                completion.complete(8);
+            }).join();
+    EXPECT_EQ(result, 0);
+
+    EXPECT_EQ(scheduler.run_once(), 1u);
+    EXPECT_EQ(result, 7);
+}
+
+TEST(AsyncSystemHandle, Completions_completed_before_being_awaited_do_not_suspend)
+{
+    async::Scheduler scheduler;
+    async::Completion<int> completion(scheduler);
+    int result = 0;
+
+    completion.complete(3);
+    scheduler.spawn(store_completion(completion, result));
+
+    EXPECT_EQ(scheduler.run_once(), 1u);
+    EXPECT_EQ(result, 3);
+}
+
+TEST(AsyncSystemHandle, Clients_await_the_reply_of_the_provider)
+{
+    async::Scheduler scheduler;
+    EchoProvider provider(scheduler);
+    async::AsyncServiceClient client(scheduler);
+
+    xtypes::StructType type("Request");
+    type.add_member("value", xtypes::primitive_type<int32_t>());
+    xtypes::DynamicData request(type);
+    request["value"] = int32_t(5);
+
+    std::unique_ptr<xtypes::DynamicData> reply;
+    scheduler.spawn(store_reply(client, provider, request, reply));
+
+    for (int spins = 0; !reply && spins < 10; ++spins)
+    {
+        scheduler.run_once();
+    }
+
+    ASSERT_TRUE(reply);
+    EXPECT_EQ((*reply)["value"].value<int32_t>(), 5);
+}
+
+TEST(AsyncSystemHandle, Spins_run_the_ready_coroutines_and_report_idle_ones)
+{
+    using SpinResult = eprosima::is::SystemHandle::SpinResult;
+
+    CountingSystem system;
+
+    EXPECT_EQ(system.spin_and_report(), SpinResult::WORK_DONE);
+    EXPECT_EQ(system.resumed, 0);
+    EXPECT_EQ(system.spin_and_report(), SpinResult::WORK_DONE);
+    EXPECT_EQ(system.resumed, 1);
+    EXPECT_EQ(system.spin_and_report(), SpinResult::WORK_DONE);
+    EXPECT_EQ(system.resumed, 2);
+    EXPECT_EQ(system.spin_and_report(), SpinResult::IDLE);
+    EXPECT_TRUE(system.spin_once());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/Config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using eprosima::is::core::internal::Config;
+using eprosima::is::core::internal::ConfigChanges;
+
+namespace {
+
+const std::string base_config = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+routes:
+    a_to_b: { from: a, to: b }
+    b_to_a: { from: b, to: a }
+    b_serves_a: { server: b, clients: a }
+topics:
+    kept: { type: "Message", route: a_to_b }
+    removed: { type: "Message", route: a_to_b }
+    rerouted: { type: "Message", route: a_to_b }
+services:
+    kept_service: { request_type: "Request", reply_type: "Reply", route: b_serves_a }
+    removed_service: { request_type: "Request", reply_type: "Reply", route: b_serves_a }
+)";
+
+Config parse(
+        const std::string& yaml)
+{
+    return Config(YAML::Load(yaml), "<test>");
+}
+
+std::vector<std::string> sorted(
+        std::vector<std::string> names)
+{
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+} //  anonymous namespace
+
+TEST(ConfigChanges, An_identical_configuration_has_no_changes)
+{
+    const Config running = parse(base_config);
+    const Config reloaded = parse(base_config);
+    ASSERT_TRUE(running);
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    ASSERT_TRUE(reloaded.changes_from(running, changes));
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST(ConfigChanges, Lists_modified_items_as_removed_and_added)
+{
+    const Config running = parse(base_config);
+    const Config reloaded = parse(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+routes:
+    a_to_b: { from: a, to: b }
+    b_to_a: { from: b, to: a }
+    b_serves_a: { server: b, clients: a }
+topics:
+    kept: { type: "Message", route: a_to_b }
+    rerouted: { type: "Message", route: b_to_a }
+    added: { type: "Message", route: a_to_b }
+services:
+    kept_service: { request_type: "Request", reply_type: "Reply", route: b_serves_a }
+    added_service: { type: "Request", route: b_serves_a }
+)");
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    ASSERT_TRUE(reloaded.changes_from(running, changes));
+
+    EXPECT_EQ(sorted(changes.topics_removed), std::vector<std::string>({"removed", "rerouted"}));
+    EXPECT_EQ(sorted(changes.topics_added), std::vector<std::string>({"added", "rerouted"}));
+    EXPECT_EQ(changes.services_removed, std::vector<std::string>({"removed_service"}));
+    EXPECT_EQ(changes.services_added, std::vector<std::string>({"added_service"}));
+}
+
+TEST(ConfigChanges, A_changed_named_route_modifies_the_topics_using_it)
+{
+    const Config running = parse(base_config);
+
+    std::string yaml = base_config;
+    const std::string route = "a_to_b: { from: a, to: b }";
+    yaml.replace(yaml.find(route), route.size(), "a_to_b: { from: a, to: [a, b] }");
+    const Config reloaded = parse(yaml);
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    ASSERT_TRUE(reloaded.changes_from(running, changes));
+
+    EXPECT_EQ(sorted(changes.topics_removed), std::vector<std::string>({"kept", "removed", "rerouted"}));
+    EXPECT_EQ(sorted(changes.topics_added), std::vector<std::string>({"kept", "removed", "rerouted"}));
+    EXPECT_TRUE(changes.services_removed.empty());
+    EXPECT_TRUE(changes.services_added.empty());
+}
+
+TEST(ConfigChanges, A_changed_topic_setting_modifies_the_topic)
+{
+    const Config running = parse(base_config);
+
+    std::string yaml = base_config;
+    const std::string topic = "kept: { type: \"Message\", route: a_to_b }";
+    yaml.replace(yaml.find(topic), topic.size(),
+            "kept: { type: \"Message\", route: a_to_b, b: { depth: 10 } }");
+    const Config reloaded = parse(yaml);
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    ASSERT_TRUE(reloaded.changes_from(running, changes));
+
+    EXPECT_EQ(changes.topics_removed, std::vector<std::string>({"kept"}));
+    EXPECT_EQ(changes.topics_added, std::vector<std::string>({"kept"}));
+}
+
+TEST(ConfigChanges, Rejects_changes_in_the_systems)
+{
+    const Config running = parse(base_config);
+
+    std::string yaml = base_config;
+    const std::string system = "b: { type: mock }";
+    yaml.replace(yaml.find(system), system.size(), "b: { type: mock, types-from: a }");
+    const Config reloaded = parse(yaml);
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    EXPECT_FALSE(reloaded.changes_from(running, changes));
+}
+
+TEST(ConfigChanges, Ignores_the_sections_applied_on_restart)
+{
+    const Config running = parse(base_config);
+    const Config reloaded = parse(base_config + R"(
+executor:
+    drain_timeout_ms: 100
+)");
+    ASSERT_TRUE(reloaded);
+
+    ConfigChanges changes;
+    ASSERT_TRUE(reloaded.changes_from(running, changes));
+    EXPECT_TRUE(changes.empty());
+}
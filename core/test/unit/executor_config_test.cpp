@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using eprosima::is::core::internal::Config;
+
+namespace {
+
+Config parse(
+        const std::string& executor)
+{
+    return Config(YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+routes:
+    a_to_b: { from: a, to: b }
+topics:
+    chatter: { type: "Message", route: a_to_b }
+executor:
+)" + executor), "<test>");
+}
+
+} //  anonymous namespace
+
+TEST(ExecutorConfig, Reads_the_threads_and_their_settings)
+{
+    const Config config = parse(R"(
+    parallel_startup: true
+    drain_timeout_ms: 500
+    stall_threshold_ms: 20
+    threads:
+        - { name: fast, systems: [a], cpus: [0, 1], priority: 10, numa_node: 0 }
+        - { systems: [b] }
+)");
+    ASSERT_TRUE(config);
+
+    EXPECT_TRUE(config.executor().parallel_startup);
+    EXPECT_EQ(config.executor().drain_timeout, std::chrono::milliseconds(500));
+    EXPECT_EQ(config.executor().stall_threshold, std::chrono::milliseconds(20));
+
+    ASSERT_EQ(config.executor().threads.size(), 2u);
+    EXPECT_EQ(config.executor().threads[0].settings.name, "fast");
+    EXPECT_EQ(config.executor().threads[0].settings.cpus, std::vector<int>({0, 1}));
+    EXPECT_EQ(config.executor().threads[0].settings.priority, 10);
+    EXPECT_EQ(config.executor().threads[0].settings.numa_node, 0);
+    EXPECT_EQ(config.executor().threads[0].systems, std::vector<std::string>({"a"}));
+    EXPECT_EQ(config.executor().threads[1].settings.name, "is-worker-1");
+}
+
+TEST(ExecutorConfig, Rejects_a_system_listed_in_two_threads)
+{
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a] }
+        - { systems: [a, b] }
+)"));
+}
+
+TEST(ExecutorConfig, Rejects_an_unknown_system)
+{
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a, c] }
+)"));
+}
+
+TEST(ExecutorConfig, Rejects_a_thread_without_systems)
+{
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { name: empty }
+)"));
+}
+
+TEST(ExecutorConfig, Rejects_a_bad_priority)
+{
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a], priority: 100 }
+)"));
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a], priority: -1 }
+)"));
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a], priority: high }
+)"));
+}
+
+TEST(ExecutorConfig, Rejects_a_bad_numa_node)
+{
+    EXPECT_FALSE(parse(R"(
+    threads:
+        - { systems: [a], numa_node: -2 }
+)"));
+    EXPECT_FALSE(parse(R"(
+    default_numa_node: first
+)"));
+}
+
+TEST(ExecutorConfig, Rejects_scalar_fields_of_the_wrong_type)
+{
+    EXPECT_FALSE(parse(R"(
+    parallel_startup: sometimes
+)"));
+    EXPECT_FALSE(parse(R"(
+    drain_timeout_ms: soon
+)"));
+    EXPECT_FALSE(parse(R"(
+    stall_threshold_ms: [20]
+)"));
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/core/runtime/LatencyHistogram.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using eprosima::is::core::LatencyHistogram;
+
+TEST(LatencyHistogram, Buckets_bound_the_relative_error)
+{
+    for (uint64_t value : {0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 1000ull, 123456789ull, ~0ull})
+    {
+        const std::size_t bucket = LatencyHistogram::bucket_of(value);
+        ASSERT_LT(bucket, LatencyHistogram::BUCKETS);
+
+        const uint64_t upper = LatencyHistogram::upper_bound(bucket);
+        ASSERT_GE(upper, value);
+        ASSERT_LE(upper - value, value / 8);
+    }
+}
+
+TEST(LatencyHistogram, Percentiles)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+
+    const LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, 1000u);
+    ASSERT_EQ(snapshot.max, 1000000u);
+    ASSERT_DOUBLE_EQ(snapshot.mean(), 500500.0);
+
+    const uint64_t median = snapshot.percentile(0.5);
+    ASSERT_GE(median, 500000u);
+    ASSERT_LE(median, 500000u + 500000u / 8);
+
+    ASSERT_EQ(snapshot.percentile(1.0), 1000000u);
+    ASSERT_EQ(LatencyHistogram().snapshot().percentile(0.99), 0u);
+}
+
+TEST(LatencyHistogram, Adds_up_the_values_recorded_by_every_thread)
+{
+    LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread <= 20; ++thread)
+    {
+        threads.emplace_back([&histogram, thread]()
+                {
+                    for (uint64_t value = 1; value <= 100; ++value)
+                    {
+                        histogram.record(value * thread);
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, 2000u);
+    ASSERT_EQ(snapshot.sum, 5050u * 210u);
+    ASSERT_EQ(snapshot.max, 2000u);
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Config.hpp>
+#include <is/core/runtime/LatencyProbe.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <initializer_list>
+#include <string>
+
+namespace xtypes = eprosima::xtypes;
+
+using eprosima::is::core::LatencyProbe;
+using eprosima::is::core::internal::Config;
+
+namespace {
+
+/**
+ * Defines the type of the probe messages as the core does.
+ */
+xtypes::DynamicType::Ptr probe_type()
+{
+    xtypes::idl::Context context;
+    xtypes::idl::parse(LatencyProbe::TYPE_IDL, context);
+    for (const auto& [name, type] : context.get_all_scoped_types())
+    {
+        if (name == LatencyProbe::TYPE_NAME || name == std::string("::") + LatencyProbe::TYPE_NAME)
+        {
+            return type;
+        }
+    }
+    return xtypes::DynamicType::Ptr();
+}
+
+/**
+ * Receives the probe messages with the given sequences, in that order.
+ */
+void receive(
+        LatencyProbe& probe,
+        const xtypes::DynamicType& type,
+        std::initializer_list<uint64_t> sequences,
+        const std::string& origin = "probe")
+{
+    for (const uint64_t sequence : sequences)
+    {
+        xtypes::DynamicData message(type);
+        message["origin"] = origin;
+        message["sequence"] = sequence;
+        message["sent_ns"] = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+        probe.receive(message);
+    }
+}
+
+} //  anonymous namespace
+
+TEST(LatencyProbe, Counts_the_skipped_sequences_as_lost)
+{
+    const xtypes::DynamicType::Ptr type = probe_type();
+    ASSERT_TRUE(type);
+    LatencyProbe probe("probe", *type);
+
+    receive(probe, *type, {1, 2, 5, 6});
+
+    const LatencyProbe::Snapshot snapshot = probe.snapshot();
+    EXPECT_EQ(snapshot.received, 4u);
+    EXPECT_EQ(snapshot.lost, 2u);
+    EXPECT_EQ(snapshot.latency.count, 4u);
+}
+
+TEST(LatencyProbe, Messages_out_of_order_are_not_lost)
+{
+    const xtypes::DynamicType::Ptr type = probe_type();
+    ASSERT_TRUE(type);
+    LatencyProbe probe("probe", *type);
+
+    receive(probe, *type, {1, 3, 2, 6, 4, 5, 7});
+
+    const LatencyProbe::Snapshot snapshot = probe.snapshot();
+    EXPECT_EQ(snapshot.received, 7u);
+    EXPECT_EQ(snapshot.lost, 0u);
+}
+
+TEST(LatencyProbe, Ignores_duplicates_and_messages_of_other_probes)
+{
+    const xtypes::DynamicType::Ptr type = probe_type();
+    ASSERT_TRUE(type);
+    LatencyProbe probe("probe", *type);
+
+    receive(probe, *type, {1, 2, 2, 1});
+    receive(probe, *type, {3, 4}, "another_probe");
+
+    const LatencyProbe::Snapshot snapshot = probe.snapshot();
+    EXPECT_EQ(snapshot.received, 2u);
+    EXPECT_EQ(snapshot.lost, 0u);
+}
+
+TEST(LatencyProbe, Starts_over_when_the_sender_restarts)
+{
+    const xtypes::DynamicType::Ptr type = probe_type();
+    ASSERT_TRUE(type);
+    LatencyProbe probe("probe", *type);
+
+    receive(probe, *type, {1, 100});
+    receive(probe, *type, {1, 2, 3});
+
+    const LatencyProbe::Snapshot snapshot = probe.snapshot();
+    EXPECT_EQ(snapshot.received, 5u);
+    EXPECT_EQ(snapshot.lost, 98u);
+}
+
+TEST(LatencyProbe, Cannot_be_sent_from_a_source_of_the_probed_topic)
+{
+    const std::string systems = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+    c: { type: mock }
+topics:
+    is_probe_bridge: { type: "is_probe", route: { from: [a, c], to: b } }
+    remapped: { type: "is_probe", route: { from: c, to: b }, remap: { c: { topic: is_probe_c } } }
+)";
+
+    EXPECT_FALSE(Config(YAML::Load(systems + R"(
+probes:
+    bridge: { topic: is_probe_bridge, from: a, to: b }
+)"), "<test>"));
+
+    EXPECT_FALSE(Config(YAML::Load(systems + R"(
+probes:
+    bridge: { topic: is_probe_c, from: c, to: b }
+)"), "<test>"));
+
+    EXPECT_TRUE(Config(YAML::Load(systems + R"(
+probes:
+    bridge: { topic: is_probe_bridge, from: b, to: a }
+)"), "<test>"));
+}
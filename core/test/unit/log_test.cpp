@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/utils/Log.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+using eprosima::is::utils::Logger;
+
+namespace {
+
+/**
+ * @brief Stands for the standard output while it is in scope, keeping what is written to it.
+ *        It can be made to hold the writer until released, or to take a while for each write,
+ *        like a slow reader at the end of a pipe.
+ */
+class CapturedOutput : public std::streambuf
+{
+public:
+
+    CapturedOutput(
+            std::chrono::microseconds delay = std::chrono::microseconds(0))
+        : _delay(delay)
+        , _held(false)
+        , _waiting(false)
+    {
+        Logger::flush();
+        _previous = std::cout.rdbuf(this);
+    }
+
+    ~CapturedOutput()
+    {
+        release();
+        Logger::flush();
+        std::cout.rdbuf(_previous);
+    }
+
+    /**
+     * @brief Makes the next write wait until release() is called.
+     */
+    void hold()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _held = true;
+    }
+
+    /**
+     * @brief Waits until a write is being held.
+     */
+    void wait_for_writer()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _changed.wait(lock, [this]()
+                {
+                    return _waiting;
+                });
+    }
+
+    void release()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _held = false;
+        _changed.notify_all();
+    }
+
+    std::string text()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _text;
+    }
+
+    /**
+     * @brief Gets the lines written which contain some text, in their order.
+     */
+    std::vector<std::string> lines_with(
+            const std::string& token)
+    {
+        std::vector<std::string> lines;
+        std::istringstream in(text());
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.find(token) != std::string::npos)
+            {
+                lines.push_back(line);
+            }
+        }
+        return lines;
+    }
+
+protected:
+
+    std::streamsize xsputn(
+            const char* s,
+            std::streamsize n) override
+    {
+        if (_delay.count() > 0)
+        {
+            std::this_thread::sleep_for(_delay);
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _waiting = _held;
+        _changed.notify_all();
+        _changed.wait(lock, [this]()
+                {
+                    return !_held;
+                });
+        _waiting = false;
+        _text.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+
+    int_type overflow(
+            int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+
+    const std::chrono::microseconds _delay;
+    std::streambuf* _previous;
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    bool _held;
+    bool _waiting;
+    std::string _text;
+};
+
+} //  anonymous namespace
+
+TEST(Logger, Flush_writes_the_messages_logged_so_far)
+{
+    CapturedOutput output;
+    Logger logger("log_test");
+
+    logger << Logger::Level::INFO << "flushed message" << std::endl;
+    Logger::flush();
+
+    EXPECT_EQ(output.lines_with("flushed message").size(), 1u);
+}
+
+TEST(Logger, Writes_every_message_of_every_thread)
+{
+    CapturedOutput output;
+    Logger logger("log_test");
+
+    constexpr int threads = 8;
+    constexpr int messages = 200;
+    std::vector<std::thread> loggers;
+    for (int t = 0; t < threads; ++t)
+    {
+        loggers.emplace_back([&logger, t]()
+                {
+                    for (int i = 0; i < messages; ++i)
+                    {
+                        logger << Logger::Level::INFO << "thread " << std::to_string(t)
+                               << " message " << std::to_string(i) << " ;" << std::endl;
+                    }
+                });
+    }
+    for (std::thread& thread : loggers)
+    {
+        thread.join();
+    }
+    Logger::flush();
+
+    /**
+     * The messages of each thread come out in the order it logged them.
+     */
+    for (int t = 0; t < threads; ++t)
+    {
+        const std::vector<std::string> lines = output.lines_with("thread " + std::to_string(t) + " message");
+        ASSERT_EQ(lines.size(), static_cast<std::size_t>(messages));
+        for (int i = 0; i < messages; ++i)
+        {
+            EXPECT_NE(lines[i].find("message " + std::to_string(i) + " ;"), std::string::npos);
+        }
+    }
+}
+
+TEST(Logger, Messages_of_different_threads_come_out_in_the_order_they_were_logged)
+{
+    CapturedOutput output(std::chrono::microseconds(200));
+    Logger logger("log_test");
+
+    /**
+     * Each thread logs once the previous one has logged, so the order of the messages
+     * is known even though they come from different threads.
+     */
+    constexpr int threads = 8;
+    constexpr int rounds = 20;
+    std::mutex mutex;
+    std::condition_variable turn_changed;
+    int turn = 0;
+
+    std::vector<std::thread> loggers;
+    for (int t = 0; t < threads; ++t)
+    {
+        loggers.emplace_back([&, t]()
+                {
+                    for (int round = 0; round < rounds; ++round)
+                    {
+                        const int step = round * threads + t;
+                        std::unique_lock<std::mutex> lock(mutex);
+                        turn_changed.wait(lock, [&]()
+                                {
+                                    return turn == step;
+                                });
+                        logger << Logger::Level::INFO << "step " << std::to_string(step) << " ;" << std::endl;
+                        ++turn;
+                        turn_changed.notify_all();
+                    }
+                });
+    }
+    for (std::thread& thread : loggers)
+    {
+        thread.join();
+    }
+    Logger::flush();
+
+    const std::vector<std::string> lines = output.lines_with("step ");
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(threads * rounds));
+    for (int step = 0; step < threads * rounds; ++step)
+    {
+        EXPECT_NE(lines[step].find("step " + std::to_string(step) + " ;"), std::string::npos)
+            << "line " << step << " is: " << lines[step];
+    }
+}
+
+TEST(Logger, Reports_the_messages_dropped_while_the_output_is_blocked)
+{
+    CapturedOutput output;
+    Logger logger("log_test");
+
+    /**
+     * The background thread gets stuck writing the first message, so the queue of this thread
+     * fills up and the rest of its messages are dropped.
+     */
+    output.hold();
+    logger << Logger::Level::INFO << "blocking message" << std::endl;
+    output.wait_for_writer();
+
+    constexpr int messages = 5000;
+    for (int i = 0; i < messages; ++i)
+    {
+        logger << Logger::Level::INFO << "burst message" << std::endl;
+    }
+    output.release();
+    Logger::flush();
+
+    const std::size_t written = output.lines_with("burst message").size();
+    EXPECT_LT(written, static_cast<std::size_t>(messages));
+
+    uint64_t dropped = 0;
+    for (const std::string& line : output.lines_with("log message(s) dropped"))
+    {
+        std::istringstream in(line.substr(line.find("] ") + 2));
+        uint64_t count = 0;
+        in >> count;
+        dropped += count;
+    }
+    EXPECT_EQ(written + dropped, static_cast<uint64_t>(messages));
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/utils/MemoryTracker.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <new>
+#include <string>
+#include <thread>
+
+using eprosima::is::utils::MemoryTracker;
+
+namespace {
+
+/**
+ * The blocks are allocated by calling the allocation functions directly, since
+ * the compiler may leave out the pairs of new and delete expressions.
+ */
+void* allocate(
+        std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void release(
+        void* block)
+{
+    ::operator delete(block);
+}
+
+MemoryTracker::Usage usage(
+        const std::string& account)
+{
+    return MemoryTracker::usage()[account];
+}
+
+} //  anonymous namespace
+
+TEST(MemoryTracker, Tracks_the_allocations)
+{
+    EXPECT_TRUE(MemoryTracker::enabled());
+    EXPECT_EQ(MemoryTracker::account("test:same"), MemoryTracker::account("test:same"));
+}
+
+TEST(MemoryTracker, Charges_the_account_of_the_innermost_scope)
+{
+    MemoryTracker::Account* const outer = MemoryTracker::account("test:outer");
+    MemoryTracker::Account* const inner = MemoryTracker::account("test:inner");
+
+    void* outer_block = nullptr;
+    void* inner_block = nullptr;
+    void* after_block = nullptr;
+    {
+        const MemoryTracker::Scope outer_scope(outer);
+        {
+            const MemoryTracker::Scope inner_scope(inner);
+            inner_block = allocate(200);
+        }
+        /**
+         * The outer account is charged again once the inner scope finishes.
+         */
+        after_block = allocate(50);
+    }
+    {
+        const MemoryTracker::Scope outer_scope(outer);
+        outer_block = allocate(100);
+    }
+
+    const MemoryTracker::Usage outer_usage = usage("test:outer");
+    EXPECT_EQ(outer_usage.allocations, 2u);
+    EXPECT_EQ(outer_usage.allocated_bytes, 150u);
+    EXPECT_EQ(outer_usage.live_bytes, 150u);
+
+    const MemoryTracker::Usage inner_usage = usage("test:inner");
+    EXPECT_EQ(inner_usage.allocations, 1u);
+    EXPECT_EQ(inner_usage.allocated_bytes, 200u);
+    EXPECT_EQ(inner_usage.live_bytes, 200u);
+
+    release(outer_block);
+    release(inner_block);
+    release(after_block);
+}
+
+TEST(MemoryTracker, Frees_the_blocks_back_into_the_account_that_allocated_them)
+{
+    MemoryTracker::Account* const owner = MemoryTracker::account("test:owner");
+    MemoryTracker::Account* const releaser = MemoryTracker::account("test:releaser");
+
+    void* block = nullptr;
+    {
+        const MemoryTracker::Scope scope(owner);
+        block = allocate(300);
+    }
+    EXPECT_EQ(usage("test:owner").live_bytes, 300u);
+
+    /**
+     * Neither the account of the scope freeing the block nor the thread matter.
+     */
+    std::thread([releaser, block]()
+            {
+                const MemoryTracker::Scope scope(releaser);
+                release(block);
+            }).join();
+
+    const MemoryTracker::Usage owner_usage = usage("test:owner");
+    EXPECT_EQ(owner_usage.allocations, 1u);
+    EXPECT_EQ(owner_usage.allocated_bytes, 300u);
+    EXPECT_EQ(owner_usage.live_bytes, 0u);
+
+    const MemoryTracker::Usage releaser_usage = usage("test:releaser");
+    EXPECT_EQ(releaser_usage.allocated_bytes, 0u);
+    EXPECT_EQ(releaser_usage.live_bytes, 0u);
+}
+
+TEST(MemoryTracker, Reports_the_usage_of_every_account)
+{
+    MemoryTracker::Account* const account = MemoryTracker::account("test:usage");
+    const MemoryTracker::ThreadCounters before = MemoryTracker::thread_counters();
+
+    void* first = nullptr;
+    void* second = nullptr;
+    {
+        const MemoryTracker::Scope scope(account);
+        first = allocate(64);
+        second = allocate(32);
+    }
+
+    const MemoryTracker::ThreadCounters after = MemoryTracker::thread_counters();
+    EXPECT_EQ(after.allocations - before.allocations, 2u);
+    EXPECT_EQ(after.bytes - before.bytes, 96u);
+
+    release(first);
+
+    /**
+     * The allocations made out of any scope, such as the map returned here, go to `other`.
+     */
+    const std::map<std::string, MemoryTracker::Usage> usages = MemoryTracker::usage();
+    ASSERT_EQ(usages.count("other"), 1u);
+    EXPECT_GT(usages.at("other").allocations, 0u);
+
+    ASSERT_EQ(usages.count("test:usage"), 1u);
+    EXPECT_EQ(usages.at("test:usage").allocations, 2u);
+    EXPECT_EQ(usages.at("test:usage").allocated_bytes, 96u);
+    EXPECT_EQ(usages.at("test:usage").live_bytes, 32u);
+
+    release(second);
+}
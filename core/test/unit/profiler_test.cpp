@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/utils/Profiler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using eprosima::is::utils::Profiler;
+
+namespace {
+
+/**
+ * Enables the Profiler with no figures while alive, and disables it afterwards.
+ */
+struct EnabledProfiler
+{
+    EnabledProfiler()
+    {
+        Profiler::reset();
+        Profiler::enable();
+    }
+
+    ~EnabledProfiler()
+    {
+        Profiler::enable(false);
+        Profiler::reset();
+    }
+};
+
+void profile(
+        const std::string& key,
+        std::chrono::milliseconds duration)
+{
+    const Profiler::Scope scope("test", key);
+    std::this_thread::sleep_for(duration);
+}
+
+} //  anonymous namespace
+
+TEST(Profiler, Ranks_the_operations_by_total_time)
+{
+    const EnabledProfiler profiler;
+
+    profile("slow", std::chrono::milliseconds(30));
+    for (int i = 0; i < 3; ++i)
+    {
+        profile("fast", std::chrono::milliseconds(1));
+    }
+    {
+        const std::string from = "Message";
+        const std::string to = "Other";
+        const Profiler::Scope scope("conversion", from, to);
+    }
+
+    const std::vector<Profiler::Entry> entries = Profiler::report();
+    ASSERT_EQ(entries.size(), 3u);
+
+    EXPECT_EQ(entries[0].key, "slow");
+    EXPECT_EQ(entries[0].calls, 1u);
+    EXPECT_GE(entries[0].nanoseconds, 30000000u);
+    EXPECT_EQ(entries[0].max_nanoseconds, entries[0].nanoseconds);
+
+    EXPECT_EQ(entries[1].key, "fast");
+    EXPECT_EQ(entries[1].calls, 3u);
+    EXPECT_LE(entries[1].max_nanoseconds, entries[1].nanoseconds);
+
+    EXPECT_EQ(entries[2].section, "conversion");
+    EXPECT_EQ(entries[2].key, "Message -> Other");
+
+    /**
+     * The table holds a header and the requested number of operations, ranked in the same way.
+     */
+    std::istringstream table(Profiler::dump(2));
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(table, line);)
+    {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_NE(lines[1].find("slow"), std::string::npos);
+    EXPECT_NE(lines[2].find("fast"), std::string::npos);
+}
+
+TEST(Profiler, Merges_the_figures_of_every_thread)
+{
+    const EnabledProfiler profiler;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([]()
+                {
+                    for (int i = 0; i < 10; ++i)
+                    {
+                        profile("shared", std::chrono::milliseconds(0));
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    /**
+     * The tables of the threads that finished are kept.
+     */
+    const std::vector<Profiler::Entry> entries = Profiler::report();
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].section, "test");
+    EXPECT_EQ(entries[0].key, "shared");
+    EXPECT_EQ(entries[0].calls, 40u);
+    EXPECT_LE(entries[0].max_nanoseconds, entries[0].nanoseconds);
+}
+
+TEST(Profiler, Reset_discards_the_figures_gathered_so_far)
+{
+    const EnabledProfiler profiler;
+
+    profile("before", std::chrono::milliseconds(0));
+    std::thread([]()
+            {
+                profile("before", std::chrono::milliseconds(0));
+            }).join();
+    ASSERT_EQ(Profiler::report().size(), 1u);
+
+    Profiler::reset();
+    EXPECT_TRUE(Profiler::report().empty());
+
+    profile("after", std::chrono::milliseconds(0));
+    const std::vector<Profiler::Entry> entries = Profiler::report();
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0].key, "after");
+    EXPECT_EQ(entries[0].calls, 1u);
+}
+
+TEST(Profiler, Nothing_is_gathered_while_disabled)
+{
+    const EnabledProfiler profiler;
+
+    Profiler::enable(false);
+    profile("disabled", std::chrono::milliseconds(0));
+    EXPECT_TRUE(Profiler::report().empty());
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/runtime/Reactor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif //  __linux__
+
+using eprosima::is::core::Reactor;
+
+#ifdef __linux__
+
+namespace {
+
+/**
+ * @brief An eventfd which stands for the wait handle of a system.
+ */
+class Event
+{
+public:
+
+    Event()
+        : fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+    }
+
+    ~Event()
+    {
+        close(fd);
+    }
+
+    void signal()
+    {
+        const uint64_t one = 1;
+        ASSERT_EQ(write(fd, &one, sizeof(one)), static_cast<ssize_t>(sizeof(one)));
+    }
+
+    void consume()
+    {
+        uint64_t count;
+        ASSERT_EQ(read(fd, &count, sizeof(count)), static_cast<ssize_t>(sizeof(count)));
+    }
+
+    const int fd;
+};
+
+} //  anonymous namespace
+
+TEST(Reactor, Dispatches_the_handler_of_a_ready_descriptor)
+{
+    Reactor reactor;
+    Event ready;
+    Event idle;
+    int ready_calls = 0;
+    int idle_calls = 0;
+
+    ASSERT_TRUE(reactor.add(ready.fd, [&]()
+            {
+                ++ready_calls;
+                ready.consume();
+                return true;
+            }));
+    ASSERT_TRUE(reactor.add(idle.fd, [&]()
+            {
+                ++idle_calls;
+                return true;
+            }));
+    ASSERT_EQ(reactor.size(), 2u);
+    ASSERT_GE(reactor.wait_handle(), 0);
+
+    ready.signal();
+    ASSERT_TRUE(reactor.run_once(std::chrono::seconds(5)));
+    EXPECT_EQ(ready_calls, 1);
+    EXPECT_EQ(idle_calls, 0);
+
+    /**
+     * Once the work is consumed, the timeout expires without dispatching anything.
+     */
+    ASSERT_TRUE(reactor.run_once(std::chrono::milliseconds(10)));
+    EXPECT_EQ(ready_calls, 1);
+    EXPECT_EQ(idle_calls, 0);
+}
+
+TEST(Reactor, Wake_up_interrupts_a_wait)
+{
+    Reactor reactor;
+    Event idle;
+    int calls = 0;
+    ASSERT_TRUE(reactor.add(idle.fd, [&]()
+            {
+                ++calls;
+                return true;
+            }));
+
+    std::thread waker([&reactor]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                reactor.wake_up();
+            });
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(reactor.run_once(std::chrono::seconds(30)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+    EXPECT_EQ(calls, 0);
+    waker.join();
+
+    /**
+     * The wake-up is consumed, so it does not interrupt the next wait.
+     */
+    const auto again = std::chrono::steady_clock::now();
+    EXPECT_TRUE(reactor.run_once(std::chrono::milliseconds(50)));
+    EXPECT_GE(std::chrono::steady_clock::now() - again, std::chrono::milliseconds(40));
+}
+
+TEST(Reactor, Reports_a_failing_handler)
+{
+    Reactor reactor;
+    Event failing;
+    Event working;
+    int working_calls = 0;
+
+    ASSERT_TRUE(reactor.add(failing.fd, [&]()
+            {
+                failing.consume();
+                return false;
+            }));
+    ASSERT_TRUE(reactor.add(working.fd, [&]()
+            {
+                ++working_calls;
+                working.consume();
+                return true;
+            }));
+
+    /**
+     * The other ready handlers are still dispatched.
+     */
+    failing.signal();
+    working.signal();
+    EXPECT_FALSE(reactor.run_once(std::chrono::seconds(5)));
+    EXPECT_EQ(working_calls, 1);
+
+    EXPECT_FALSE(reactor.add(-1, []()
+            {
+                return true;
+            }));
+}
+
+TEST(Reactor, Dispatches_again_while_the_descriptor_stays_readable)
+{
+    Reactor reactor;
+    Event event;
+    int calls = 0;
+    bool consume = false;
+
+    ASSERT_TRUE(reactor.add(event.fd, [&]()
+            {
+                ++calls;
+                if (consume)
+                {
+                    event.consume();
+                }
+                return true;
+            }));
+
+    /**
+     * A handler which leaves work pending is dispatched again without a new signal.
+     */
+    event.signal();
+    ASSERT_TRUE(reactor.run_once(std::chrono::seconds(5)));
+    ASSERT_TRUE(reactor.run_once(std::chrono::seconds(5)));
+    EXPECT_EQ(calls, 2);
+
+    consume = true;
+    ASSERT_TRUE(reactor.run_once(std::chrono::seconds(5)));
+    EXPECT_EQ(calls, 3);
+
+    ASSERT_TRUE(reactor.run_once(std::chrono::milliseconds(10)));
+    EXPECT_EQ(calls, 3);
+}
+
+#endif //  __linux__
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/runtime/ServiceBatcher.hpp>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace xtypes = eprosima::xtypes;
+
+using eprosima::is::ServiceClient;
+using eprosima::is::ServiceProvider;
+using eprosima::is::core::ServiceBatcher;
+using eprosima::is::core::TimerQueue;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Provider that records the value of the requests of each batch it gets.
+ */
+class Provider : public ServiceProvider
+{
+public:
+
+    void call_service(
+            const xtypes::DynamicData& /*request*/,
+            ServiceClient& /*client*/,
+            std::shared_ptr<void> /*call_handle*/) override
+    {
+    }
+
+    void call_service_batch(
+            const std::vector<Request>& requests) override
+    {
+        std::vector<int32_t> values;
+        for (const Request& request : requests)
+        {
+            values.push_back(request.request["value"].value<int32_t>());
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        batches.emplace_back(std::move(values));
+        received.notify_all();
+    }
+
+    /**
+     * Waits until the given number of batches has been received, or the timeout expires.
+     */
+    std::vector<std::vector<int32_t> > wait_for(
+            std::size_t count,
+            std::chrono::milliseconds timeout = std::chrono::seconds(5))
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        received.wait_for(lock, timeout, [&]()
+                {
+                    return batches.size() >= count;
+                });
+        return batches;
+    }
+
+    std::mutex mutex;
+    std::condition_variable received;
+    std::vector<std::vector<int32_t> > batches;
+};
+
+class Client : public ServiceClient
+{
+public:
+
+    void receive_response(
+            std::shared_ptr<void> /*call_handle*/,
+            const xtypes::DynamicData& /*response*/) override
+    {
+    }
+
+};
+
+class ServiceBatcherTest : public testing::Test
+{
+protected:
+
+    ServiceBatcherTest()
+        : type("Message")
+        , provider(std::make_shared<Provider>())
+    {
+        type.add_member("value", xtypes::primitive_type<int32_t>());
+    }
+
+    void call(
+            ServiceBatcher& batcher,
+            int32_t value)
+    {
+        xtypes::DynamicData request(type);
+        request["value"] = value;
+        batcher.call_service(request, client, nullptr);
+    }
+
+    xtypes::StructType type;
+    std::shared_ptr<Provider> provider;
+    Client client;
+    TimerQueue timers;
+};
+
+} //  anonymous namespace
+
+TEST_F(ServiceBatcherTest, Sends_full_batches_right_away)
+{
+    ServiceBatcher::Policy policy;
+    policy.window = std::chrono::hours(1);
+    policy.max_size = 3;
+    ServiceBatcher batcher("test", policy, provider, timers);
+
+    for (int32_t value = 0; value < 7; ++value)
+    {
+        call(batcher, value);
+    }
+
+    const auto batches = provider->wait_for(2);
+    ASSERT_EQ(batches, std::vector<std::vector<int32_t> >({{0, 1, 2}, {3, 4, 5}}));
+
+    batcher.flush();
+    ASSERT_EQ(provider->wait_for(3).back(), std::vector<int32_t>({6}));
+
+    /**
+     * Flushing with nothing pending sends nothing.
+     */
+    batcher.flush();
+    ASSERT_EQ(provider->wait_for(4, std::chrono::milliseconds(0)).size(), 3u);
+}
+
+TEST_F(ServiceBatcherTest, Sends_partial_batches_when_the_window_expires)
+{
+    ServiceBatcher::Policy policy;
+    policy.window = std::chrono::milliseconds(20);
+    policy.max_size = 32;
+    ServiceBatcher batcher("test", policy, provider, timers);
+
+    const Clock::time_point start = Clock::now();
+    call(batcher, 1);
+    call(batcher, 2);
+
+    const auto batches = provider->wait_for(1);
+    ASSERT_GE(Clock::now() - start, policy.window);
+    ASSERT_EQ(batches, std::vector<std::vector<int32_t> >({{1, 2}}));
+}
+
+TEST_F(ServiceBatcherTest, The_window_of_a_full_batch_does_not_cut_the_next_one)
+{
+    ServiceBatcher::Policy policy;
+    policy.window = std::chrono::milliseconds(200);
+    policy.max_size = 2;
+    ServiceBatcher batcher("test", policy, provider, timers);
+
+    call(batcher, 1);
+    call(batcher, 2);
+    ASSERT_EQ(provider->wait_for(1).size(), 1u);
+
+    /**
+     * The window opened by the first batch expires before the one of the second batch,
+     * which must keep waiting for its own window.
+     */
+    std::this_thread::sleep_for(policy.window / 2);
+    const Clock::time_point second = Clock::now();
+    call(batcher, 3);
+
+    std::this_thread::sleep_for(policy.window * 3 / 4);
+    ASSERT_EQ(provider->wait_for(2, std::chrono::milliseconds(0)).size(), 1u);
+
+    const auto batches = provider->wait_for(2);
+    ASSERT_GE(Clock::now() - second, policy.window);
+    ASSERT_EQ(batches, std::vector<std::vector<int32_t> >({{1, 2}, {3}}));
+}
+
+TEST_F(ServiceBatcherTest, Sends_right_away_once_the_timers_are_stopped)
+{
+    ServiceBatcher::Policy policy;
+    policy.window = std::chrono::hours(1);
+    ServiceBatcher batcher("test", policy, provider, timers);
+
+    timers.stop();
+    call(batcher, 1);
+
+    ASSERT_EQ(provider->wait_for(1, std::chrono::milliseconds(0)),
+            std::vector<std::vector<int32_t> >({{1}}));
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/runtime/ServiceHedging.hpp>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace xtypes = eprosima::xtypes;
+
+using eprosima::is::ServiceClient;
+using eprosima::is::ServiceProvider;
+using eprosima::is::core::ServiceHedging;
+using eprosima::is::core::TimerQueue;
+
+namespace {
+
+xtypes::StructType message_type()
+{
+    xtypes::StructType type("Message");
+    type.add_member("value", xtypes::primitive_type<int32_t>());
+    return type;
+}
+
+/**
+ * Client that counts the responses it gets, and signals the first one.
+ */
+class Client : public ServiceClient
+{
+public:
+
+    void receive_response(
+            std::shared_ptr<void> call_handle,
+            const xtypes::DynamicData& response) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        handles.push_back(call_handle);
+        if (handles.size() == 1)
+        {
+            first.set_value(response["value"].value<int32_t>());
+        }
+    }
+
+    std::size_t responses()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return handles.size();
+    }
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<void> > handles;
+    std::promise<int32_t> first;
+};
+
+/**
+ * Provider that answers right away, or keeps the calls for the test to answer them.
+ */
+class Provider : public ServiceProvider
+{
+public:
+
+    struct Call
+    {
+        ServiceClient* client;
+        std::shared_ptr<void> handle;
+    };
+
+    explicit Provider(
+            bool answer_right_away)
+        : synchronous(answer_right_away)
+    {
+    }
+
+    void call_service(
+            const xtypes::DynamicData& request,
+            ServiceClient& client,
+            std::shared_ptr<void> call_handle) override
+    {
+        if (synchronous)
+        {
+            client.receive_response(call_handle, request);
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        calls.push_back(Call{&client, call_handle});
+        if (calls.size() == 2)
+        {
+            hedged.set_value();
+        }
+    }
+
+    /**
+     * The call handles refer back to this provider, so they are released at the end of the tests.
+     */
+    void release()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        calls.clear();
+    }
+
+    void answer(
+            std::size_t call,
+            int32_t value)
+    {
+        Call answered;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            answered = calls.at(call);
+        }
+
+        static const xtypes::StructType type = message_type();
+        xtypes::DynamicData response(type);
+        response["value"] = value;
+        answered.client->receive_response(answered.handle, response);
+    }
+
+    const bool synchronous;
+    std::mutex mutex;
+    std::vector<Call> calls;
+    std::promise<void> hedged;
+};
+
+} //  anonymous namespace
+
+TEST(ServiceHedging, Uses_the_initial_delay_until_there_are_enough_samples)
+{
+    TimerQueue timers;
+
+    ServiceHedging::Policy policy;
+    policy.initial_delay = std::chrono::milliseconds(50);
+    policy.min_delay = std::chrono::milliseconds(1);
+    policy.window = 16;
+    policy.min_samples = 8;
+
+    ServiceHedging hedging("test", policy, timers);
+    ASSERT_EQ(hedging.hedge_delay(), std::chrono::milliseconds(50));
+
+    const xtypes::StructType type = message_type();
+    xtypes::DynamicData request(type);
+    auto provider = std::make_shared<Provider>(true);
+    Client client;
+
+    for (std::size_t i = 1; i < policy.min_samples; ++i)
+    {
+        hedging.call_service(provider, request, client, nullptr);
+    }
+    ASSERT_EQ(hedging.hedge_delay(), std::chrono::milliseconds(50));
+
+    /**
+     * The synchronous responses take far less than the initial delay,
+     * so the percentile falls to the minimum delay.
+     */
+    for (std::size_t i = 0; i < policy.window; ++i)
+    {
+        hedging.call_service(provider, request, client, nullptr);
+    }
+    ASSERT_EQ(hedging.hedge_delay(), std::chrono::milliseconds(1));
+
+    const ServiceHedging::Statistics statistics = hedging.statistics();
+    ASSERT_EQ(statistics.requests, policy.min_samples - 1 + policy.window);
+    ASSERT_EQ(statistics.hedged, 0u);
+    ASSERT_EQ(timers.pending(), 0u);
+}
+
+TEST(ServiceHedging, Delivers_only_the_first_response)
+{
+    TimerQueue timers;
+
+    ServiceHedging::Policy policy;
+    policy.initial_delay = std::chrono::milliseconds(5);
+    policy.min_delay = std::chrono::milliseconds(1);
+
+    ServiceHedging hedging("test", policy, timers);
+
+    const xtypes::StructType type = message_type();
+    xtypes::DynamicData request(type);
+    auto provider = std::make_shared<Provider>(false);
+    Client client;
+    auto handle = std::make_shared<int>(42);
+
+    hedging.call_service(provider, request, client, handle);
+    ASSERT_EQ(provider->hedged.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    /**
+     * The hedged request is answered first, so the original response is discarded.
+     */
+    provider->answer(1, 2);
+    provider->answer(0, 1);
+
+    auto first = client.first.get_future();
+    ASSERT_EQ(first.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(first.get(), 2);
+    ASSERT_EQ(client.responses(), 1u);
+    ASSERT_EQ(client.handles.front(), handle);
+
+    const ServiceHedging::Statistics statistics = hedging.statistics();
+    ASSERT_EQ(statistics.requests, 1u);
+    ASSERT_EQ(statistics.hedged, 1u);
+    ASSERT_EQ(statistics.hedge_wins, 1u);
+
+    provider->release();
+}
+
+TEST(ServiceHedging, Does_not_hedge_answered_requests)
+{
+    TimerQueue timers;
+
+    ServiceHedging::Policy policy;
+    policy.initial_delay = std::chrono::milliseconds(5);
+    policy.min_delay = std::chrono::milliseconds(1);
+
+    ServiceHedging hedging("test", policy, timers);
+
+    const xtypes::StructType type = message_type();
+    xtypes::DynamicData request(type);
+    auto provider = std::make_shared<Provider>(false);
+    Client client;
+
+    hedging.call_service(provider, request, client, nullptr);
+    provider->answer(0, 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    {
+        std::unique_lock<std::mutex> lock(provider->mutex);
+        ASSERT_EQ(provider->calls.size(), 1u);
+    }
+    ASSERT_EQ(hedging.statistics().hedged, 0u);
+    ASSERT_EQ(client.responses(), 1u);
+
+    provider->release();
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/runtime/ShardExecutor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+using eprosima::is::core::ShardExecutor;
+using eprosima::is::core::ThreadSettings;
+
+TEST(ShardExecutor, Runs_the_tasks_of_threads_that_already_finished)
+{
+    ShardExecutor executor(std::vector<ThreadSettings>(2), 4);
+    std::atomic_int executed(0);
+
+    /**
+     * Each thread gets its own queues, which are dropped once it finishes and they are empty.
+     */
+    for (int round = 0; round < 50; ++round)
+    {
+        std::thread([&executor, &executed]()
+                {
+                    for (std::size_t shard = 0; shard < executor.size(); ++shard)
+                    {
+                        ASSERT_TRUE(executor.post(shard, [&executed]()
+                                {
+                                    ++executed;
+                                }));
+                    }
+                }).join();
+    }
+
+    executor.stop();
+    EXPECT_EQ(executed, 100);
+}
+
+TEST(ShardExecutor, Shards_do_not_wait_for_a_full_queue)
+{
+    ShardExecutor executor(std::vector<ThreadSettings>(1), 2);
+    std::promise<std::size_t> rejected;
+
+    /**
+     * The shard fills its own queue, which only it could empty.
+     */
+    ASSERT_TRUE(executor.post(0, [&executor, &rejected]()
+            {
+                std::size_t count = 0;
+                for (int i = 0; i < 10; ++i)
+                {
+                    if (!executor.post(0, []()
+                    {
+                    }))
+                    {
+                        ++count;
+                    }
+                }
+                rejected.set_value(count);
+            }));
+
+    std::future<std::size_t> result = rejected.get_future();
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(result.get(), 8u);
+}
+
+TEST(ShardExecutor, Rejects_tasks_once_stopped)
+{
+    ShardExecutor executor(std::vector<ThreadSettings>(1), 2);
+    executor.stop();
+
+    EXPECT_FALSE(executor.post(0, []()
+            {
+            }));
+}
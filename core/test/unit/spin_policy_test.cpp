@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/runtime/SpinPolicy.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif //  __linux__
+
+using eprosima::is::core::SpinPolicy;
+using eprosima::is::core::SpinStrategy;
+
+namespace {
+
+/**
+ * Idle spins that the adaptive backoff polls and yields before it starts sleeping.
+ */
+constexpr int SPINS_BEFORE_SLEEPING = 128;
+
+SpinPolicy adaptive_backoff(
+        std::chrono::microseconds max_backoff)
+{
+    SpinPolicy policy;
+    policy.kind = SpinPolicy::Kind::ADAPTIVE_BACKOFF;
+    policy.max_backoff = max_backoff;
+    return policy;
+}
+
+} //  anonymous namespace
+
+TEST(SpinStrategy, Backs_off_up_to_the_maximum)
+{
+    SpinStrategy strategy(adaptive_backoff(std::chrono::microseconds(8)));
+
+    for (int i = 0; i < SPINS_BEFORE_SLEEPING; ++i)
+    {
+        ASSERT_EQ(strategy.next_wait(), std::chrono::microseconds(0)) << "idle spin " << i;
+        strategy.idle();
+    }
+
+    for (const int expected : {1, 2, 4, 8, 8, 8})
+    {
+        EXPECT_EQ(strategy.next_wait(), std::chrono::microseconds(expected));
+        strategy.idle();
+    }
+}
+
+TEST(SpinStrategy, Work_resets_the_backoff)
+{
+    SpinStrategy strategy(adaptive_backoff(std::chrono::microseconds(1000)));
+
+    for (int i = 0; i < SPINS_BEFORE_SLEEPING + 4; ++i)
+    {
+        strategy.idle();
+    }
+    ASSERT_EQ(strategy.next_wait(), std::chrono::microseconds(16));
+
+    /**
+     * After some work, it polls again before sleeping, starting with the shortest sleep.
+     */
+    strategy.worked();
+    for (int i = 0; i < SPINS_BEFORE_SLEEPING; ++i)
+    {
+        ASSERT_EQ(strategy.next_wait(), std::chrono::microseconds(0)) << "idle spin " << i;
+        strategy.idle();
+    }
+    EXPECT_EQ(strategy.next_wait(), std::chrono::microseconds(1));
+}
+
+TEST(SpinStrategy, Polling_policies_never_wait)
+{
+    for (const SpinPolicy::Kind kind : {SpinPolicy::Kind::BUSY_POLL, SpinPolicy::Kind::YIELD})
+    {
+        SpinPolicy policy;
+        policy.kind = kind;
+        SpinStrategy strategy(policy);
+
+        for (int i = 0; i < 2 * SPINS_BEFORE_SLEEPING; ++i)
+        {
+            strategy.idle();
+        }
+        EXPECT_EQ(strategy.next_wait(), std::chrono::microseconds(0));
+    }
+}
+
+#ifdef __linux__
+TEST(SpinStrategy, Blocking_returns_once_a_wait_handle_is_readable)
+{
+    const int event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_GE(event, 0);
+
+    SpinPolicy policy;
+    policy.kind = SpinPolicy::Kind::BLOCKING;
+    policy.block_timeout = std::chrono::seconds(30);
+    SpinStrategy strategy(policy, {event});
+    EXPECT_EQ(strategy.next_wait(), std::chrono::seconds(30));
+
+    const uint64_t one = 1;
+    ASSERT_EQ(write(event, &one, sizeof(one)), static_cast<ssize_t>(sizeof(one)));
+
+    /**
+     * The descriptor stays readable, so every wait returns right away.
+     */
+    const auto start = std::chrono::steady_clock::now();
+    strategy.idle();
+    strategy.idle();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+
+    close(event);
+}
+#endif //  __linux__
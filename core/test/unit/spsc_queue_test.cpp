@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <is/utils/SpscQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using eprosima::is::utils::SpscQueue;
+
+TEST(SpscQueue, Keeps_order_and_capacity)
+{
+    SpscQueue<int> queue(3);
+    ASSERT_EQ(queue.capacity(), 4u);
+    ASSERT_TRUE(queue.empty());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.try_push(int(i)));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(SpscQueue, Transfers_between_threads)
+{
+    constexpr int count = 10000;
+    SpscQueue<int> queue(64);
+
+    std::thread producer([&queue]()
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    while (!queue.try_push(int(i)))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+    int expected = 0;
+    int value = -1;
+    while (expected < count)
+    {
+        if (queue.try_pop(value))
+        {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        }
+    }
+
+    producer.join();
+    ASSERT_TRUE(queue.empty());
+}
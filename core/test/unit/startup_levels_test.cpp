@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Config.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using eprosima::is::core::internal::Config;
+
+namespace {
+
+using Levels = std::vector<std::vector<std::string> >;
+
+Config parse(
+        const std::string& systems)
+{
+    return Config(YAML::Load(R"(
+systems:
+)" + systems + R"(
+topics:
+    chatter: { type: "Message", route: { from: a, to: b } }
+)"), "<test>");
+}
+
+} //  anonymous namespace
+
+TEST(StartupLevels, Loads_a_chain_one_system_per_level)
+{
+    const Config config = parse(R"(
+    a: { type: mock }
+    b: { type: mock, types-from: a }
+    c: { type: mock, types-from: b }
+)");
+    ASSERT_TRUE(config);
+
+    Levels levels;
+    ASSERT_TRUE(config.startup_levels(levels));
+    EXPECT_EQ(levels, Levels({{"a"}, {"b"}, {"c"}}));
+}
+
+TEST(StartupLevels, Loads_the_independent_systems_of_a_diamond_together)
+{
+    const Config config = parse(R"(
+    a: { type: mock }
+    b: { type: mock, types-from: a }
+    c: { type: mock, types-from: a }
+    d: { type: mock, types-from: [b, c] }
+    e: { type: mock }
+)");
+    ASSERT_TRUE(config);
+
+    Levels levels;
+    ASSERT_TRUE(config.startup_levels(levels));
+    EXPECT_EQ(levels, Levels({{"a", "e"}, {"b", "c"}, {"d"}}));
+}
+
+TEST(StartupLevels, Rejects_circular_references)
+{
+    const Config config = parse(R"(
+    a: { type: mock }
+    b: { type: mock, types-from: [a, d] }
+    c: { type: mock, types-from: b }
+    d: { type: mock, types-from: c }
+)");
+    ASSERT_TRUE(config);
+
+    Levels levels;
+    EXPECT_FALSE(config.startup_levels(levels));
+}
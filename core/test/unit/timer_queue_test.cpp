@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/runtime/TimerQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using eprosima::is::core::TimerQueue;
+
+TEST(TimerQueue, Runs_tasks_in_deadline_order)
+{
+    TimerQueue timers("test-timers");
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+
+    const auto record = [&](int id)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                order.push_back(id);
+            };
+
+    const TimerQueue::Clock::time_point now = TimerQueue::Clock::now();
+    ASSERT_TRUE(timers.schedule(now + std::chrono::milliseconds(30), [&]()
+            {
+                record(3);
+                done.set_value();
+            }));
+    ASSERT_TRUE(timers.schedule(now + std::chrono::milliseconds(10), [&]()
+            {
+                record(1);
+            }));
+
+    /**
+     * Tasks with the same deadline run in scheduling order.
+     */
+    ASSERT_TRUE(timers.schedule(now + std::chrono::milliseconds(20), [&]()
+            {
+                record(2);
+            }));
+    ASSERT_TRUE(timers.schedule(now + std::chrono::milliseconds(20), [&]()
+            {
+                record(22);
+            }));
+
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_EQ(order, std::vector<int>({1, 2, 22, 3}));
+}
+
+TEST(TimerQueue, Waits_for_the_deadline)
+{
+    TimerQueue timers;
+
+    const TimerQueue::Clock::time_point start = TimerQueue::Clock::now();
+    std::promise<TimerQueue::Clock::time_point> executed;
+    ASSERT_TRUE(timers.schedule_after(std::chrono::milliseconds(20), [&]()
+            {
+                executed.set_value(TimerQueue::Clock::now());
+            }));
+
+    auto future = executed.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_GE(future.get() - start, std::chrono::milliseconds(20));
+}
+
+TEST(TimerQueue, Stop_discards_the_pending_tasks)
+{
+    TimerQueue timers;
+
+    std::atomic_int executed(0);
+    ASSERT_TRUE(timers.schedule_after(std::chrono::hours(1), [&]()
+            {
+                ++executed;
+            }));
+    ASSERT_TRUE(timers.schedule_after(std::chrono::hours(1), [&]()
+            {
+                ++executed;
+            }));
+    ASSERT_EQ(timers.pending(), 2u);
+
+    timers.stop();
+    ASSERT_EQ(timers.pending(), 0u);
+    ASSERT_EQ(executed.load(), 0);
+
+    ASSERT_FALSE(timers.schedule_after(std::chrono::milliseconds(0), [&]()
+            {
+                ++executed;
+            }));
+    ASSERT_EQ(timers.pending(), 0u);
+}
+
+TEST(TimerQueue, Tasks_can_schedule_other_tasks)
+{
+    TimerQueue timers;
+
+    std::promise<int> done;
+    std::function<void(int)> step = [&](int remaining)
+            {
+                if (remaining == 0)
+                {
+                    done.set_value(remaining);
+                    return;
+                }
+
+                timers.schedule_after(std::chrono::milliseconds(1), [&step, remaining]()
+                        {
+                            step(remaining - 1);
+                        });
+            };
+
+    ASSERT_TRUE(timers.schedule_after(std::chrono::milliseconds(0), [&step]()
+            {
+                step(5);
+            }));
+
+    auto future = done.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(future.get(), 0);
+}
+
+TEST(TimerQueue, A_task_can_stop_and_destroy_its_queue)
+{
+    std::unique_ptr<TimerQueue> timers(new TimerQueue());
+
+    std::promise<void> done;
+    ASSERT_TRUE(timers->schedule_after(std::chrono::milliseconds(0), [&]()
+            {
+                timers->stop();
+                timers.reset();
+                done.set_value();
+            }));
+
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(timers, nullptr);
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/runtime/TopicDemand.hpp>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+
+namespace xtypes = eprosima::xtypes;
+
+using eprosima::is::TopicPublisher;
+using eprosima::is::core::TimerQueue;
+using eprosima::is::core::TopicDemand;
+
+namespace {
+
+/**
+ * Publisher whose matched subscribers are set by the test.
+ */
+class Publisher : public TopicPublisher
+{
+public:
+
+    bool publish(
+            const xtypes::DynamicData& /*message*/) override
+    {
+        return true;
+    }
+
+    bool set_matched_callback(
+            MatchedCallback callback) override
+    {
+        matched = std::move(callback);
+        matched(0);
+        return true;
+    }
+
+    MatchedCallback matched;
+};
+
+/**
+ * Source that counts how many times it gets subscribed and unsubscribed.
+ */
+struct Source
+{
+    bool switch_subscription(
+            bool subscribe)
+    {
+        if (subscribe)
+        {
+            ++subscriptions;
+            return true;
+        }
+
+        ++unsubscriptions;
+        return can_unsubscribe;
+    }
+
+    bool can_unsubscribe = true;
+    int subscriptions = 0;
+    int unsubscriptions = 0;
+};
+
+class TopicDemandTest : public ::testing::Test
+{
+protected:
+
+    TopicDemandTest()
+        : timers("test-timers")
+        , gate(std::make_shared<std::atomic_bool>(true))
+        , demand("topic", gate, timers)
+    {
+        demand.add_publisher(publisher);
+    }
+
+    void add(
+            Source& source)
+    {
+        demand.add_source([&source](bool subscribe)
+                {
+                    return source.switch_subscription(subscribe);
+                });
+    }
+
+    /**
+     * Waits for the switches scheduled so far, since tasks with the same deadline run in order.
+     */
+    void wait_for_switches()
+    {
+        std::promise<void> done;
+        ASSERT_TRUE(timers.schedule_after(std::chrono::milliseconds(0), [&done]()
+                {
+                    done.set_value();
+                }));
+        done.get_future().wait();
+    }
+
+    TimerQueue timers;
+    std::shared_ptr<std::atomic_bool> gate;
+    Publisher publisher;
+    TopicDemand demand;
+};
+
+} //  anonymous namespace
+
+TEST_F(TopicDemandTest, Subscribes_the_sources_only_while_there_is_demand)
+{
+    Source source;
+    add(source);
+
+    ASSERT_TRUE(demand.start());
+    EXPECT_FALSE(demand.active());
+    EXPECT_EQ(source.subscriptions, 0);
+
+    publisher.matched(2);
+    wait_for_switches();
+    EXPECT_TRUE(demand.active());
+    EXPECT_EQ(source.subscriptions, 1);
+
+    publisher.matched(1);
+    wait_for_switches();
+    EXPECT_EQ(source.subscriptions, 1);
+
+    publisher.matched(0);
+    wait_for_switches();
+    EXPECT_FALSE(demand.active());
+    EXPECT_EQ(source.unsubscriptions, 1);
+}
+
+TEST_F(TopicDemandTest, Asks_a_source_that_cannot_unsubscribe_only_once)
+{
+    Source source;
+    source.can_unsubscribe = false;
+    add(source);
+
+    ASSERT_TRUE(demand.start());
+    for (int i = 0; i < 3; ++i)
+    {
+        publisher.matched(1);
+        wait_for_switches();
+        publisher.matched(0);
+        wait_for_switches();
+    }
+
+    /**
+     * The source keeps its first subscription, which is never duplicated.
+     */
+    EXPECT_EQ(source.subscriptions, 1);
+    EXPECT_EQ(source.unsubscriptions, 1);
+
+    *gate = false;
+    EXPECT_FALSE(demand.stop());
+    EXPECT_EQ(source.unsubscriptions, 1);
+}
+
+TEST_F(TopicDemandTest, Stop_unsubscribes_each_source_once)
+{
+    Source source;
+    add(source);
+
+    publisher.matched(1);
+    wait_for_switches();
+    publisher.matched(0);
+    wait_for_switches();
+    ASSERT_EQ(source.subscriptions, 1);
+    ASSERT_EQ(source.unsubscriptions, 1);
+
+    /**
+     * The source was already unsubscribed when the demand dropped, so stopping does not ask it again.
+     */
+    *gate = false;
+    EXPECT_TRUE(demand.stop());
+    EXPECT_EQ(source.unsubscriptions, 1);
+
+    /**
+     * Once stopped, the demand does not subscribe the source anymore.
+     */
+    publisher.matched(3);
+    wait_for_switches();
+    EXPECT_TRUE(demand.stop());
+    EXPECT_EQ(source.subscriptions, 1);
+    EXPECT_EQ(source.unsubscriptions, 1);
+}
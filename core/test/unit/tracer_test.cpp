@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Config.hpp>
+#include <is/core/runtime/Tracer.hpp>
+#include <is/json-xtypes/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif //  __linux__
+
+using eprosima::is::core::Tracer;
+using eprosima::is::core::internal::Config;
+using Json = nlohmann::json;
+
+namespace {
+
+/**
+ * Gives each test its own trace file, and removes it along with its rotated files.
+ */
+class TraceFile
+{
+public:
+
+    TraceFile(
+            const std::string& name)
+#ifdef __linux__
+        : path("/tmp/is-tracer-test-" + std::to_string(getpid()) + "-" + name + ".json")
+#else
+        : path("is-tracer-test-" + name + ".json")
+#endif //  __linux__
+    {
+        clear();
+    }
+
+    ~TraceFile()
+    {
+        clear();
+    }
+
+    std::string rotated(
+            std::size_t index) const
+    {
+        return path + "." + std::to_string(index);
+    }
+
+    const std::string path;
+
+private:
+
+    void clear()
+    {
+        std::remove(path.c_str());
+        for (std::size_t i = 1; i <= 4; ++i)
+        {
+            std::remove(rotated(i).c_str());
+        }
+    }
+};
+
+bool exists(
+        const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+Json read(
+        const std::string& path)
+{
+    std::ifstream file(path);
+    return Json::parse(file);
+}
+
+void record(
+        Tracer& tracer,
+        const std::string& route)
+{
+    const auto start = Tracer::Clock::now();
+    tracer.record(tracer.sample(), "publish", route, "b", start, start + std::chrono::microseconds(3));
+}
+
+} //  anonymous namespace
+
+TEST(Tracer, Writes_the_spans_in_the_chrome_trace_format)
+{
+    const TraceFile file("format");
+    Tracer::Policy policy;
+    policy.file = file.path;
+    policy.sample_rate = 1.0;
+
+    {
+        Tracer tracer(policy);
+        record(tracer, "topic:plain");
+        record(tracer, "topic:\"quoted\\\"");
+    }
+
+    const Json spans = read(file.path);
+    ASSERT_TRUE(spans.is_array());
+    ASSERT_EQ(spans.size(), 2u);
+
+    EXPECT_EQ(spans[0]["name"], "publish");
+    EXPECT_EQ(spans[0]["ph"], "X");
+    EXPECT_EQ(spans[0]["cat"], "topic:plain");
+    EXPECT_EQ(spans[0]["args"]["route"], "topic:plain");
+    EXPECT_EQ(spans[0]["args"]["system"], "b");
+    EXPECT_DOUBLE_EQ(spans[0]["dur"].get<double>(), 3.0);
+    EXPECT_NE(spans[0]["args"]["trace"], spans[1]["args"]["trace"]);
+
+    EXPECT_EQ(spans[1]["args"]["route"], "topic:\"quoted\\\"");
+}
+
+TEST(Tracer, Rotates_the_file_once_it_reaches_its_maximum_size)
+{
+    const TraceFile file("rotation");
+    Tracer::Policy policy;
+    policy.file = file.path;
+    policy.sample_rate = 1.0;
+    policy.max_file_size = 1000;
+    policy.max_files = 2;
+
+    {
+        Tracer tracer(policy);
+        for (int i = 0; i < 50; ++i)
+        {
+            record(tracer, "topic:rotated");
+        }
+    }
+
+    /**
+     * Only the configured number of rotated files is kept, and each of them is a complete trace.
+     */
+    ASSERT_TRUE(exists(file.rotated(1)));
+    ASSERT_TRUE(exists(file.rotated(2)));
+    EXPECT_FALSE(exists(file.rotated(3)));
+
+    for (const std::string& path : {file.path, file.rotated(1), file.rotated(2)})
+    {
+        const Json spans = read(path);
+        EXPECT_TRUE(spans.is_array()) << path;
+    }
+
+    std::ifstream rotated(file.rotated(1), std::ios::ate);
+    EXPECT_GE(static_cast<std::size_t>(rotated.tellg()), policy.max_file_size);
+}
+
+TEST(Tracer, Samples_no_message_or_every_message)
+{
+    const TraceFile file("sampling");
+    Tracer::Policy policy;
+    policy.file = file.path;
+
+    policy.sample_rate = 0.0;
+    {
+        Tracer tracer(policy);
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(tracer.sample(), 0u);
+        }
+    }
+
+    policy.sample_rate = 1.0;
+    {
+        Tracer tracer(policy);
+        std::set<uint64_t> traces;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const uint64_t trace = tracer.sample();
+            EXPECT_NE(trace, 0u);
+            traces.insert(trace);
+        }
+        EXPECT_EQ(traces.size(), 1000u);
+    }
+}
+
+TEST(Tracer, The_configuration_rejects_a_sample_rate_out_of_range)
+{
+    const auto parse = [](const std::string& sample_rate)
+            {
+                return static_cast<bool>(Config(YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+topics:
+    chatter: { type: "Message", route: { from: a, to: b } }
+tracing: { sample_rate: )" + sample_rate + " }"), "<test>"));
+            };
+
+    EXPECT_TRUE(parse("0.5"));
+    EXPECT_FALSE(parse("1.5"));
+    EXPECT_FALSE(parse("-0.1"));
+    EXPECT_FALSE(parse(".nan"));
+}
@@ -17,6 +17,7 @@
  */
 
 #include <is/json-xtypes/conversion.hpp>
+#include <is/utils/Profiler.hpp>
 #include <stack>
 #include <limits>
 
@@ -315,11 +316,18 @@ bool xtypes_to_json(
         });
 }
 
+/**
+ * Name given to the JSON side of the conversions in the profiler.
+ */
+static const std::string JSON_NAME = "json";
+
 //==============================================================================
 Json convert(
         const xtypes::DynamicData& xtypes_message,
         const std::string submember)
 {
+    const utils::Profiler::Scope profile("json_xtypes::convert", xtypes_message.type().name(), JSON_NAME);
+
     Json json_message;
     xtypes_to_json(xtypes_message, json_message, submember);
     return json_message;
@@ -331,6 +339,8 @@ xtypes::DynamicData convert(
         const Json& json_message,
         const std::string submember)
 {
+    const utils::Profiler::Scope profile("json_xtypes::convert", JSON_NAME, type.name());
+
     xtypes::DynamicData xtypes_message(type);
     json_to_xtypes(json_message, xtypes_message, submember);
     return xtypes_message;
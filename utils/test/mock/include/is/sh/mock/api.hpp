@@ -23,6 +23,7 @@
 #include <is/mock/export.hpp> // TODO (@jamoralp): convert this into is/sh/mock
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <string>
@@ -43,6 +44,20 @@ bool IS_MOCK_API subscribe(
         const std::string& topic,
         MockSubscriptionCallback callback);
 
+/// Remove every subscription made with subscribe() to a topic. The publishers
+/// of the topic report that they have no matched subscribers anymore.
+bool IS_MOCK_API unsubscribe(
+        const std::string& topic);
+
+/// Number of publishers that Integration Service has advertised for a topic.
+std::size_t IS_MOCK_API advertisements(
+        const std::string& topic);
+
+/// Makes the next spin of any mock system block for some time, like a middleware
+/// that got stuck.
+void IS_MOCK_API stall_next_spin(
+        std::chrono::milliseconds duration);
+
 // TODO (@jamoralp): mock documentation
 
 /// Request a service
@@ -65,6 +80,19 @@ void IS_MOCK_API serve(
         MockServiceCallback callback,
         const std::string& type = "");
 
+/// Sends the reply of a request served with serve_later().
+using MockReply = std::function<void (const xtypes::DynamicData& response)>;
+
+using MockDeferredServiceCallback = std::function<void (const xtypes::DynamicData& request, MockReply reply)>;
+
+/// Serve a service whose replies are sent later on. The callback receives each
+/// request along with the function that replies to it, which can be called from
+/// any thread, or never, to withhold the reply.
+void IS_MOCK_API serve_later(
+        const std::string& topic,
+        MockDeferredServiceCallback callback,
+        const std::string& type = "");
+
 
 } //  namespace mock
 } //  namespace sh
@@ -20,7 +20,9 @@
 
 #include <is/systemhandle/SystemHandle.hpp>
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <thread>
 
 // TODO(@jamoralp): Document doxygen
@@ -53,12 +55,43 @@ public:
     Channels clients;
     Channels services;
 
+    // Number of publishers advertised for each topic.
+    std::map<std::string, std::size_t> advertisements;
+
+    // Duration of the next stalled spin, in milliseconds, or zero.
+    std::atomic<int64_t> next_stall{0};
+
     std::map<std::string, TopicSubscriberSystem::SubscriptionCallback*> is_subscription_callbacks;
 
     std::map<std::string, ServiceClientSystem::RequestCallback*> is_request_callbacks;
 
     std::map<std::string, std::vector<MockSubscriptionCallback> > mock_subscriptions;
     std::map<std::string, MockServiceCallback> mock_services;
+    std::map<std::string, MockDeferredServiceCallback> mock_deferred_services;
+
+    // The core may subscribe and unsubscribe from its own threads, for the topics
+    // configured on demand, while the test publishes messages.
+    std::mutex subscriptions_mutex;
+
+    // Callbacks of the publishers that report their matched subscribers, by topic.
+    std::map<std::string, std::vector<TopicPublisher::MatchedCallback> > matched_callbacks;
+    std::mutex matched_mutex;
+
+    void notify_matched(
+            const std::string& topic,
+            std::size_t matched_subscribers)
+    {
+        std::vector<TopicPublisher::MatchedCallback> callbacks;
+        {
+            std::unique_lock<std::mutex> lock(matched_mutex);
+            callbacks = matched_callbacks[topic];
+        }
+
+        for (const auto& callback : callbacks)
+        {
+            callback(matched_subscribers);
+        }
+    }
 
     // We deposit references to clients into this vector to guarantee that their
     // promises don't get broken and the user has a chance to read them. This is a
@@ -121,6 +154,19 @@ public:
         return true;
     }
 
+    bool set_matched_callback(
+            MatchedCallback callback) override
+    {
+        {
+            std::unique_lock<std::mutex> lock(impl().matched_mutex);
+            impl().matched_callbacks[_topic].push_back(callback);
+        }
+
+        const auto it = impl().mock_subscriptions.find(_topic);
+        callback(it == impl().mock_subscriptions.end() ? 0 : it->second.size());
+        return true;
+    }
+
     const std::string _topic;
 
 };
@@ -142,12 +188,23 @@ public:
             ServiceClient& client,
             std::shared_ptr<void> call_handle) override
     {
-        bool only_service = impl().mock_services.count(_service) > 0;
-        const auto it =
-                (only_service
-                ? impl().mock_services.find(_service)
-                : impl().mock_services.find(_service + "_" + request.type().name()));
+        bool only_service = impl().mock_services.count(_service) > 0
+                || impl().mock_deferred_services.count(_service) > 0;
+        const std::string key = only_service ? _service : _service + "_" + request.type().name();
+
+        const auto deferred = impl().mock_deferred_services.find(key);
+        if (deferred != impl().mock_deferred_services.end())
+        {
+            ServiceClient* const reply_client = &client;
+            deferred->second(request, [reply_client, call_handle](
+                        const eprosima::xtypes::DynamicData& response)
+                    {
+                        reply_client->receive_response(call_handle, response);
+                    });
+            return;
+        }
 
+        const auto it = impl().mock_services.find(key);
         if (it == impl().mock_services.end())
         {
             throw std::runtime_error(
@@ -189,17 +246,52 @@ public:
         return true;
     }
 
+    SpinResult spin_and_report() override
+    {
+        const int64_t stall = impl().next_stall.exchange(0);
+        if (stall > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(stall));
+        }
+
+        // Messages and requests are delivered synchronously, so there is never
+        // pending work. The core decides how to wait, according to the spin policy.
+        return SpinResult::IDLE;
+    }
+
     bool subscribe(
             const std::string& topic_name,
             const eprosima::xtypes::DynamicType& message_type,
             TopicSubscriberSystem::SubscriptionCallback* callback,
             const YAML::Node& /*configuration*/) override
     {
+        std::unique_lock<std::mutex> lock(impl().subscriptions_mutex);
         impl().subscriptions[topic_name].insert(message_type.name());
         impl().is_subscription_callbacks[topic_name] = callback;
         return true;
     }
 
+    bool unsubscribe(
+            const std::string& topic_name) override
+    {
+        std::unique_lock<std::mutex> lock(impl().subscriptions_mutex);
+        if (impl().subscriptions.erase(topic_name) == 0)
+        {
+            // Unsubscribing twice is a bug in Integration Service
+            throw std::runtime_error(
+                      "Integration Service attempted to unsubscribe from a topic "
+                      "that it was not subscribed to: " + topic_name);
+        }
+
+        impl().is_subscription_callbacks.erase(topic_name);
+        return true;
+    }
+
+    bool can_unsubscribe() const override
+    {
+        return true;
+    }
+
     bool is_internal_message(
             void* /*filter_message*/)
     {
@@ -212,6 +304,7 @@ public:
             const YAML::Node& /*configuration*/) override
     {
         impl().publishers[topic_name].insert(message_type.name());
+        ++impl().advertisements[topic_name];
         return std::make_shared<Publisher>(topic_name);
     }
 
@@ -242,20 +335,25 @@ bool publish_message(
         const std::string& topic,
         const eprosima::xtypes::DynamicData& msg)
 {
-    const auto it = impl().subscriptions.find(topic);
-    if (it == impl().subscriptions.end() ||
-            it->second.find(msg.type().name()) == it->second.end())
+    TopicSubscriberSystem::SubscriptionCallback* callback = nullptr;
     {
-        return false;
-    }
+        std::unique_lock<std::mutex> lock(impl().subscriptions_mutex);
+        const auto it = impl().subscriptions.find(topic);
+        if (it == impl().subscriptions.end() ||
+                it->second.find(msg.type().name()) == it->second.end())
+        {
+            return false;
+        }
 
-    const auto cb = impl().is_subscription_callbacks.find(topic);
-    if (cb == impl().is_subscription_callbacks.end())
-    {
-        return false;
+        const auto cb = impl().is_subscription_callbacks.find(topic);
+        if (cb == impl().is_subscription_callbacks.end())
+        {
+            return false;
+        }
+        callback = cb->second;
     }
 
-    (*cb->second)(msg, nullptr);
+    (*callback)(msg, nullptr);
 
     return true;
 }
@@ -272,9 +370,38 @@ bool subscribe(
     }
 
     impl().mock_subscriptions[topic].emplace_back(std::move(callback));
+    impl().notify_matched(topic, impl().mock_subscriptions[topic].size());
+    return true;
+}
+
+//==============================================================================
+bool unsubscribe(
+        const std::string& topic)
+{
+    if (impl().mock_subscriptions.erase(topic) == 0)
+    {
+        return false;
+    }
+
+    impl().notify_matched(topic, 0);
     return true;
 }
 
+//==============================================================================
+std::size_t advertisements(
+        const std::string& topic)
+{
+    const auto it = impl().advertisements.find(topic);
+    return it == impl().advertisements.end() ? 0 : it->second;
+}
+
+//==============================================================================
+void stall_next_spin(
+        std::chrono::milliseconds duration)
+{
+    impl().next_stall = duration.count();
+}
+
 //==============================================================================
 class MockServiceClient
     : public virtual ServiceClient,
@@ -408,6 +535,30 @@ void serve(
     }
 }
 
+//==============================================================================
+void serve_later(
+        const std::string& topic,
+        MockDeferredServiceCallback callback,
+        const std::string& type)
+{
+    const auto it = impl().services.find(topic);
+    if (it == impl().services.end())
+    {
+        throw std::runtime_error(
+                  "you are attempting to serve something from mock middleware "
+                  "that it is not providing: " + topic);
+    }
+
+    const std::string key = type.empty() ? topic : topic + "_" + type;
+    if (impl().mock_services.count(key) > 0
+            || !impl().mock_deferred_services.insert(std::make_pair(key, callback)).second)
+    {
+        throw std::runtime_error(
+                  "you are attempting to serve [" + topic + "], but it is already "
+                  "being served!");
+    }
+}
+
 } //  namespace mock
 } //  namespace sh
 } //  namespace is
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const YAML::Node drainable_config = YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    forwarded: { type: "Message", route: { from: a, to: b } }
+executor: { drain_timeout_ms: 2000 }
+)");
+
+const std::string services_config = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+services:
+    withheld: { type: "Message", route: { server: b, clients: a } }
+    delayed: { type: "Message", route: { server: b, clients: a } }
+    batched:
+        type: "Message"
+        route: { server: b, clients: a }
+        batching: { window_us: 10000000, max_size: 8 }
+)";
+
+} //  anonymous namespace
+
+TEST(Drain, Stops_the_instance_once_drained)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        drainable_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    const is::core::DrainReport report = handle.drain(std::chrono::milliseconds(500));
+    EXPECT_TRUE(report.complete);
+    EXPECT_TRUE(report.unfinished.empty());
+    EXPECT_EQ(handle.wait(), 0);
+}
+
+TEST(Drain, Embedded_instances_are_drained_from_the_polling_thread)
+{
+    is::core::Instance instance(drainable_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    is::core::InstanceHandle handle = instance.run_embedded();
+    ASSERT_TRUE(handle.poll_once(std::chrono::milliseconds(1)));
+
+    const auto start = std::chrono::steady_clock::now();
+    const is::core::DrainReport report = handle.drain(std::chrono::milliseconds(2000));
+    EXPECT_TRUE(report.complete);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+
+    EXPECT_FALSE(handle.poll_once(std::chrono::milliseconds(1)));
+}
+
+TEST(Drain, Reports_the_calls_still_waiting_for_their_reply)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        YAML::Load(services_config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    /**
+     * The server keeps the call, but never replies.
+     */
+    std::vector<is::sh::mock::MockReply> withheld;
+    is::sh::mock::serve_later("withheld", [&withheld](const xtypes::DynamicData&, is::sh::mock::MockReply send)
+            {
+                withheld.emplace_back(std::move(send));
+            });
+
+    xtypes::DynamicData request(*handle.type_registry("a")->at("Message"));
+    is::sh::mock::request("withheld", request);
+
+    const is::core::DrainReport report = handle.drain(std::chrono::milliseconds(200));
+    EXPECT_FALSE(report.complete);
+    ASSERT_EQ(report.unfinished.count("service:withheld"), 1u);
+    EXPECT_EQ(report.unfinished.at("service:withheld"), 1);
+    EXPECT_EQ(handle.wait(), 0);
+
+    withheld.clear();
+}
+
+TEST(Drain, Waits_for_the_reply_of_a_call)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        YAML::Load(services_config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    /**
+     * The server replies once the instance is already draining.
+     */
+    std::promise<is::sh::mock::MockReply> reply;
+    is::sh::mock::serve_later("delayed", [&reply](const xtypes::DynamicData&, is::sh::mock::MockReply send)
+            {
+                reply.set_value(std::move(send));
+            });
+
+    xtypes::DynamicData request(*handle.type_registry("a")->at("Message"));
+    request["value"] = 5;
+    std::shared_future<xtypes::DynamicData> response = is::sh::mock::request("delayed", request);
+
+    std::thread server([&reply, &request]()
+            {
+                is::sh::mock::MockReply send = reply.get_future().get();
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                send(request);
+            });
+
+    const is::core::DrainReport report = handle.drain(std::chrono::milliseconds(2000));
+    server.join();
+
+    EXPECT_TRUE(report.complete);
+    EXPECT_TRUE(report.unfinished.empty());
+    ASSERT_EQ(response.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(response.get()["value"].value<int32_t>(), 5);
+    EXPECT_EQ(handle.wait(), 0);
+}
+
+TEST(Drain, Flushes_the_requests_waiting_for_their_batch)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        YAML::Load(services_config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    is::sh::mock::serve("batched", [](const xtypes::DynamicData& request)
+            {
+                return request;
+            });
+
+    /**
+     * The batch would wait ten seconds for other requests.
+     */
+    xtypes::DynamicData request(*handle.type_registry("a")->at("Message"));
+    request["value"] = 3;
+    std::shared_future<xtypes::DynamicData> response = is::sh::mock::request("batched", request);
+    EXPECT_EQ(response.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+    const auto start = std::chrono::steady_clock::now();
+    const is::core::DrainReport report = handle.drain(std::chrono::milliseconds(2000));
+    EXPECT_TRUE(report.complete);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+
+    ASSERT_EQ(response.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(response.get()["value"].value<int32_t>(), 3);
+    EXPECT_EQ(handle.wait(), 0);
+}
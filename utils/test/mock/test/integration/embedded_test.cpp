@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const YAML::Node embedded_config = YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    embedded: { type: "Message", route: { from: a, to: b } }
+)");
+
+} //  anonymous namespace
+
+TEST(Embedded, Forwards_messages_when_polled)
+{
+    is::core::Instance instance(embedded_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    is::core::InstanceHandle handle = instance.run_embedded();
+    ASSERT_TRUE(handle.running());
+
+    std::atomic<int> received(0);
+    ASSERT_TRUE(is::sh::mock::subscribe("embedded", [&received](const xtypes::DynamicData& message)
+            {
+                received = message["value"].value<int32_t>();
+            }));
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+    message["value"] = 9;
+    ASSERT_TRUE(is::sh::mock::publish_message("embedded", message));
+
+    for (int i = 0; i < 100 && received == 0; ++i)
+    {
+        ASSERT_TRUE(handle.poll_once(std::chrono::milliseconds(10)));
+    }
+    EXPECT_EQ(received, 9);
+
+    is::sh::mock::unsubscribe("embedded");
+    handle.quit();
+    EXPECT_FALSE(handle.poll_once(std::chrono::milliseconds(0)));
+}
+
+TEST(Embedded, Quit_wakes_up_a_blocked_poll)
+{
+    is::core::Instance instance(embedded_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    is::core::InstanceHandle handle = instance.run_embedded();
+    ASSERT_TRUE(handle.poll_once(std::chrono::milliseconds(0)));
+
+    std::thread quitter([&handle]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                handle.quit();
+            });
+
+    /**
+     * The mock systems never have work to do, so the poll blocks until it is woken up.
+     */
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(handle.poll_once(std::chrono::seconds(30)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+
+    quitter.join();
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const YAML::Node described_config = YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    described: { type: "Message", route: { from: a, to: b }, remap: { b: { topic: "renamed" } } }
+services:
+    answered: { type: "Message", route: { server: b, clients: a } }
+)");
+
+} //  anonymous namespace
+
+TEST(Introspection, Describes_the_systems_and_routes_of_the_instance)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        described_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    const is::core::Introspection introspection = handle.introspect();
+    ASSERT_EQ(introspection.systems.size(), 2u);
+    EXPECT_EQ(introspection.systems.at("a"), "mock");
+    EXPECT_EQ(introspection.systems.at("b"), "mock");
+
+    ASSERT_EQ(introspection.topics.count("described"), 1u);
+    const is::core::Introspection::Route& topic = introspection.topics.at("described");
+    ASSERT_EQ(topic.sources.size(), 1u);
+    EXPECT_EQ(topic.sources[0].system, "a");
+    EXPECT_EQ(topic.sources[0].name, "described");
+    EXPECT_EQ(topic.sources[0].type, "Message");
+    ASSERT_EQ(topic.destinations.size(), 1u);
+    EXPECT_EQ(topic.destinations[0].system, "b");
+    EXPECT_EQ(topic.destinations[0].name, "renamed");
+    ASSERT_EQ(topic.publications.size(), 1u);
+    EXPECT_EQ(topic.publications[0].from, "a");
+    EXPECT_EQ(topic.publications[0].to, "b");
+    EXPECT_EQ(topic.publications[0].consistency, xtypes::TypeConsistency::EQUALS);
+    EXPECT_TRUE(topic.open);
+
+    ASSERT_EQ(introspection.services.count("answered"), 1u);
+    const is::core::Introspection::Route& service = introspection.services.at("answered");
+    ASSERT_EQ(service.sources.size(), 1u);
+    EXPECT_EQ(service.sources[0].system, "a");
+    ASSERT_EQ(service.destinations.size(), 1u);
+    EXPECT_EQ(service.destinations[0].system, "b");
+
+    EXPECT_EQ(introspection.spins.size(), 2u);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+TEST(Introspection, Reports_the_live_figures_of_the_routes)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        described_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+    ASSERT_TRUE(is::sh::mock::publish_message("described", message));
+
+    const is::core::Introspection introspection = handle.introspect();
+    const is::core::Introspection::Route& topic = introspection.topics.at("described");
+    EXPECT_EQ(topic.metrics.messages, 1u);
+    EXPECT_EQ(topic.metrics.dropped, 0u);
+    EXPECT_EQ(topic.in_flight, 0);
+    EXPECT_EQ(topic.rejected, 0u);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+#include <is/utils/Log.hpp>
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif //  __linux__
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const YAML::Node metrics_config = YAML::Load(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    measured: { type: "Message", route: { from: a, to: b } }
+metrics: { port: 0 }
+)");
+
+#ifdef __linux__
+/**
+ * Gets the metrics served on a local port, or an empty string if they could not be fetched.
+ */
+std::string scrape(
+        uint16_t port)
+{
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return "";
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    std::string response;
+    const std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0
+            && send(fd, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size()))
+    {
+        char buffer[4096];
+        ssize_t received = 0;
+        while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        {
+            response.append(buffer, static_cast<std::size_t>(received));
+        }
+    }
+
+    close(fd);
+    return response;
+}
+
+/**
+ * Stands for the standard output while it is in scope, keeping what the logger writes to it.
+ */
+class CapturedOutput : public std::streambuf
+{
+public:
+
+    CapturedOutput()
+    {
+        is::utils::Logger::flush();
+        _previous = std::cout.rdbuf(this);
+    }
+
+    ~CapturedOutput()
+    {
+        is::utils::Logger::flush();
+        std::cout.rdbuf(_previous);
+    }
+
+    /**
+     * Counts the lines written so far which contain some text.
+     */
+    std::size_t count(
+            const std::string& token)
+    {
+        is::utils::Logger::flush();
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::istringstream in(_text);
+        std::size_t lines = 0;
+        for (std::string line; std::getline(in, line);)
+        {
+            lines += line.find(token) != std::string::npos ? 1 : 0;
+        }
+        return lines;
+    }
+
+protected:
+
+    std::streamsize xsputn(
+            const char* s,
+            std::streamsize n) override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _text.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+
+    int_type overflow(
+            int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+
+    std::streambuf* _previous;
+    std::mutex _mutex;
+    std::string _text;
+};
+
+/**
+ * Waits for a condition that the instance fulfills from its own threads.
+ */
+bool eventually(
+        const std::function<bool()>& condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+#endif //  __linux__
+
+} //  anonymous namespace
+
+#ifdef __linux__
+TEST(Metrics, Serves_the_figures_of_the_instance_on_an_ephemeral_port)
+{
+    is::core::InstanceHandle handle = is::run_instance(
+        metrics_config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+    ASSERT_NE(handle.metrics_port(), 0u);
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+    ASSERT_TRUE(is::sh::mock::publish_message("measured", message));
+    ASSERT_TRUE(is::sh::mock::publish_message("measured", message));
+
+    const std::string response = scrape(handle.metrics_port());
+    EXPECT_EQ(response.rfind("HTTP/1.1 200", 0), 0u) << response;
+    EXPECT_NE(response.find("is_route_messages_total{route=\"topic:measured\"} 2\n"), std::string::npos);
+    EXPECT_NE(response.find("is_route_dropped_total{route=\"topic:measured\"} 0\n"), std::string::npos);
+    EXPECT_NE(response.find("is_system_up{system=\"a\"} 1\n"), std::string::npos);
+    EXPECT_NE(response.find("is_system_up{system=\"b\"} 1\n"), std::string::npos);
+    EXPECT_NE(response.find("# TYPE is_route_publish_seconds summary\n"), std::string::npos);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+TEST(Metrics, Counts_each_stalled_spin_once)
+{
+    CapturedOutput output;
+
+    YAML::Node config = YAML::Clone(metrics_config);
+    config["executor"]["stall_threshold_ms"] = 50;
+    is::core::InstanceHandle handle = is::run_instance(
+        config, {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+    ASSERT_TRUE(handle.running());
+
+    std::mutex mutex;
+    std::vector<std::pair<std::string, std::chrono::milliseconds> > stalls;
+    handle.on_stall([&](const std::string& system, std::chrono::milliseconds duration)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                stalls.emplace_back(system, duration);
+            });
+
+    /**
+     * The spin lasts several times the threshold, so the watchdog sees it stalled on many checks.
+     */
+    is::sh::mock::stall_next_spin(std::chrono::milliseconds(400));
+    ASSERT_TRUE(eventually([&output]()
+            {
+                return output.count("resumed after spending") > 0;
+            }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(output.count("in a single spin: its middleware is not being served"), 1u);
+    EXPECT_EQ(output.count("resumed after spending"), 1u);
+
+    std::string stalled;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_EQ(stalls.size(), 1u);
+        stalled = stalls[0].first;
+        EXPECT_GE(stalls[0].second, std::chrono::milliseconds(50));
+    }
+
+    const std::string other = (stalled == "a" ? "b" : "a");
+    const std::string response = scrape(handle.metrics_port());
+    EXPECT_NE(response.find("is_system_stalls_total{system=\"" + stalled + "\"} 1\n"), std::string::npos)
+        << response;
+    EXPECT_NE(response.find("is_system_stalls_total{system=\"" + other + "\"} 0\n"), std::string::npos)
+        << response;
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+#endif //  __linux__
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const std::string on_demand_config = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    demanded: { type: "Message", route: { from: a, to: b }, on_demand: true }
+    kept: { type: "Message", route: { from: a, to: b } }
+)";
+
+is::core::InstanceHandle run(
+        const std::string& config)
+{
+    return is::run_instance(YAML::Load(config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+}
+
+/**
+ * Waits for a condition that the instance fulfills from its own threads.
+ */
+bool eventually(
+        const std::function<bool()>& condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+} //  anonymous namespace
+
+TEST(OnDemand, Subscribes_the_source_while_the_destination_has_subscribers)
+{
+    is::core::InstanceHandle handle = run(on_demand_config);
+    ASSERT_TRUE(handle.running());
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+    message["value"] = 7;
+
+    /**
+     * Nobody listens on the destination, so the source is not subscribed.
+     */
+    EXPECT_FALSE(is::sh::mock::publish_message("demanded", message));
+
+    std::atomic_int received(0);
+    ASSERT_TRUE(is::sh::mock::subscribe("demanded", [&received](const xtypes::DynamicData& data)
+            {
+                received = data["value"].value<int32_t>();
+            }));
+
+    ASSERT_TRUE(eventually([&message]()
+            {
+                return is::sh::mock::publish_message("demanded", message);
+            }));
+    EXPECT_EQ(received, 7);
+
+    ASSERT_TRUE(is::sh::mock::unsubscribe("demanded"));
+    EXPECT_TRUE(eventually([&message]()
+            {
+                return !is::sh::mock::publish_message("demanded", message);
+            }));
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+TEST(OnDemand, Removing_an_inactive_topic_does_not_unsubscribe_it_again)
+{
+    is::core::InstanceHandle handle = run(on_demand_config);
+    ASSERT_TRUE(handle.running());
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+
+    ASSERT_TRUE(is::sh::mock::subscribe("demanded", [](const xtypes::DynamicData&)
+            {
+            }));
+    ASSERT_TRUE(eventually([&message]()
+            {
+                return is::sh::mock::publish_message("demanded", message);
+            }));
+
+    ASSERT_TRUE(is::sh::mock::unsubscribe("demanded"));
+    ASSERT_TRUE(eventually([&message]()
+            {
+                return !is::sh::mock::publish_message("demanded", message);
+            }));
+
+    /**
+     * The mock throws if it is asked to unsubscribe from a topic it is not subscribed to.
+     */
+    YAML::Node without_topic = YAML::Load(on_demand_config);
+    without_topic["topics"].remove("demanded");
+    EXPECT_TRUE(handle.reload(without_topic));
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+is::core::InstanceHandle run(
+        const std::string& config)
+{
+    return is::run_instance(YAML::Load(config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+}
+
+/**
+ * Publishes a message on the source of a topic and tells whether the destination got it.
+ */
+bool forwards(
+        is::core::InstanceHandle& handle,
+        const std::string& system,
+        const std::string& topic)
+{
+    auto promise = std::make_shared<std::promise<void> >();
+    std::future<void> received = promise->get_future();
+    if (!is::sh::mock::subscribe(topic, [promise](const xtypes::DynamicData&)
+            {
+                promise->set_value();
+            }))
+    {
+        return false;
+    }
+
+    xtypes::DynamicData message(*handle.type_registry(system)->at("Message"));
+    const bool published = is::sh::mock::publish_message(topic, message);
+    is::sh::mock::unsubscribe(topic);
+
+    return published && received.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+}
+
+} //  anonymous namespace
+
+TEST(ParallelStartup, Loads_the_systems_of_each_level_concurrently)
+{
+    /**
+     * The systems a, b and c are loaded together, and d once they are done.
+     */
+    is::core::InstanceHandle handle = run(R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+    c: { type: mock }
+    d: { type: mock, types-from: a }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    parallel_a_to_b: { type: "Message", route: { from: a, to: b } }
+    parallel_c_to_d: { type: "Message", route: { from: c, to: d } }
+executor:
+    parallel_startup: true
+)");
+    ASSERT_TRUE(handle.running());
+
+    for (const char* system : {"a", "b", "c", "d"})
+    {
+        EXPECT_NE(handle.type_registry(system), nullptr) << system;
+    }
+
+    EXPECT_TRUE(forwards(handle, "a", "parallel_a_to_b"));
+    EXPECT_TRUE(forwards(handle, "c", "parallel_c_to_d"));
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
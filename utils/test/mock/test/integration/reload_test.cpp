@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 - present Proyectos y Sistemas de Mantenimiento SL (eProsima).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <is/core/Instance.hpp>
+#include <is/sh/mock/api.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+
+namespace is = eprosima::is;
+namespace xtypes = eprosima::xtypes;
+
+namespace {
+
+const std::string reload_config = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    reload_base:
+        type: "Message"
+        route: { from: a, to: b }
+        a: { depth: 1 }
+        b: { depth: 1 }
+)";
+
+is::core::InstanceHandle run(
+        const std::string& config)
+{
+    return is::run_instance(YAML::Load(config), {}, {{"mock", {MOCK_TEST__MIX_DIRECTORY}}});
+}
+
+/**
+ * Publishes a message on the source of a topic and returns the value that
+ * the destination received, or -1 if nothing arrived.
+ */
+int forward(
+        is::core::InstanceHandle& handle,
+        const std::string& topic,
+        int value)
+{
+    auto promise = std::make_shared<std::promise<int> >();
+    std::future<int> received = promise->get_future();
+    if (!is::sh::mock::subscribe(topic, [promise](const xtypes::DynamicData& message)
+            {
+                try
+                {
+                    promise->set_value(message["value"].value<int32_t>());
+                }
+                catch (const std::future_error&)
+                {
+                    // A late message of a previous forward().
+                }
+            }))
+    {
+        return -1;
+    }
+
+    xtypes::DynamicData message(*handle.type_registry("a")->at("Message"));
+    message["value"] = value;
+    const bool published = is::sh::mock::publish_message(topic, message);
+    is::sh::mock::unsubscribe(topic);
+
+    if (!published || received.wait_for(std::chrono::seconds(5)) != std::future_status::ready)
+    {
+        return -1;
+    }
+    return received.get();
+}
+
+} //  anonymous namespace
+
+TEST(Reload, Adds_a_topic)
+{
+    is::core::InstanceHandle handle = run(reload_config);
+    ASSERT_TRUE(handle.running());
+
+    const std::size_t advertised = is::sh::mock::advertisements("reload_base");
+    EXPECT_EQ(forward(handle, "reload_added", 1), -1);
+
+    YAML::Node with_topic = YAML::Load(reload_config);
+    with_topic["topics"]["reload_added"] = YAML::Load(R"({ type: "Message", route: { from: a, to: b } })");
+    ASSERT_TRUE(handle.reload(with_topic));
+
+    EXPECT_EQ(forward(handle, "reload_added", 2), 2);
+    EXPECT_EQ(forward(handle, "reload_base", 3), 3);
+    EXPECT_EQ(is::sh::mock::advertisements("reload_added"), 1u);
+    EXPECT_EQ(is::sh::mock::advertisements("reload_base"), advertised);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+TEST(Reload, Modifies_a_topic_reusing_its_publishers)
+{
+    const std::string config = R"(
+systems:
+    a: { type: mock }
+    b: { type: mock }
+types:
+    idls: [ "struct Message { long value; };" ]
+topics:
+    reload_modified:
+        type: "Message"
+        route: { from: a, to: b }
+        a: { depth: 1 }
+        b: { depth: 1 }
+)";
+
+    is::core::InstanceHandle handle = run(config);
+    ASSERT_TRUE(handle.running());
+    EXPECT_EQ(forward(handle, "reload_modified", 1), 1);
+    EXPECT_EQ(is::sh::mock::advertisements("reload_modified"), 1u);
+
+    /**
+     * Only the configuration of the source changes, so the destination keeps its publisher.
+     */
+    YAML::Node modified = YAML::Load(config);
+    modified["topics"]["reload_modified"]["a"]["depth"] = 10;
+    ASSERT_TRUE(handle.reload(modified));
+    EXPECT_EQ(forward(handle, "reload_modified", 2), 2);
+
+    /**
+     * Going back and forth does not advertise the topic again either.
+     */
+    ASSERT_TRUE(handle.reload(YAML::Load(config)));
+    ASSERT_TRUE(handle.reload(modified));
+    EXPECT_EQ(forward(handle, "reload_modified", 3), 3);
+    EXPECT_EQ(is::sh::mock::advertisements("reload_modified"), 1u);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}
+
+TEST(Reload, Rejects_an_incompatible_route)
+{
+    is::core::InstanceHandle handle = run(reload_config);
+    ASSERT_TRUE(handle.running());
+    const std::size_t advertised = is::sh::mock::advertisements("reload_base");
+
+    /**
+     * A route to a system that does not exist.
+     */
+    YAML::Node unknown_system = YAML::Load(reload_config);
+    unknown_system["topics"]["reload_base"]["route"]["to"] = "c";
+    EXPECT_FALSE(handle.reload(unknown_system));
+
+    /**
+     * A route that would need a publisher with another configuration.
+     */
+    YAML::Node new_publisher = YAML::Load(reload_config);
+    new_publisher["topics"]["reload_base"]["b"]["depth"] = 10;
+    EXPECT_FALSE(handle.reload(new_publisher));
+
+    /**
+     * The instance keeps running with the previous configuration.
+     */
+    EXPECT_EQ(forward(handle, "reload_base", 1), 1);
+    EXPECT_EQ(is::sh::mock::advertisements("reload_base"), advertised);
+
+    EXPECT_EQ(handle.quit().wait(), 0);
+}